@@ -0,0 +1,177 @@
+// Микробенчмарк вершинного шейдера: обращение матрицы модели для каждой вершины
+// против матрицы нормалей, вычисленной на CPU один раз (см. src/transform.h).
+// Рисуем плотную сетку треугольников в окно просмотра 1x1, поэтому время кадра определяется вершинной стадией
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../src/transform.h"
+
+#include <iostream>
+#include <vector>
+
+static const char* vertexInverse = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+out vec3 Normal;
+uniform mat4 model;
+uniform mat4 viewProjection;
+void main()
+{
+    Normal = mat3(transpose(inverse(model))) * aNormal;
+    gl_Position = viewProjection * model * vec4(aPos, 1.0);
+})";
+
+static const char* vertexUniform = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+out vec3 Normal;
+uniform mat4 model;
+uniform mat4 viewProjection;
+uniform mat3 normalMatrix;
+void main()
+{
+    Normal = normalMatrix * aNormal;
+    gl_Position = viewProjection * model * vec4(aPos, 1.0);
+})";
+
+// Нормаль выводится в цвет, чтобы компилятор не выбросил её вычисление
+static const char* fragmentSource = R"(#version 330 core
+in vec3 Normal;
+out vec4 FragColor;
+void main()
+{
+    FragColor = vec4(Normal, 1.0);
+})";
+
+static unsigned int compileProgram(const char* vs, const char* fs)
+{
+    unsigned int vertex = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertex, 1, &vs, NULL);
+    glCompileShader(vertex);
+    unsigned int fragment = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragment, 1, &fs, NULL);
+    glCompileShader(fragment);
+
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    glLinkProgram(program);
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
+
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        char infoLog[1024];
+        glGetProgramInfoLog(program, 1024, NULL, infoLog);
+        std::cout << "ERROR::PROGRAM_LINKING_ERROR\n" << infoLog << std::endl;
+    }
+    return program;
+}
+
+// Среднее время GPU на один проход (в миллисекундах)
+static double measure(unsigned int program, unsigned int vertexCount, bool uploadNormalMatrix, int passes)
+{
+    glUseProgram(program);
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(0.5f, 0.0f, 0.5f));
+    glm::mat4 viewProjection = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 100.0f);
+    glUniformMatrix4fv(glGetUniformLocation(program, "model"), 1, GL_FALSE, &model[0][0]);
+    glUniformMatrix4fv(glGetUniformLocation(program, "viewProjection"), 1, GL_FALSE, &viewProjection[0][0]);
+    if (uploadNormalMatrix)
+    {
+        glm::mat3 normalMatrix = NormalMatrix(model);
+        glUniformMatrix3fv(glGetUniformLocation(program, "normalMatrix"), 1, GL_FALSE, &normalMatrix[0][0]);
+    }
+
+    // Прогрев
+    glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+    glFinish();
+
+    unsigned int query;
+    glGenQueries(1, &query);
+    glBeginQuery(GL_TIME_ELAPSED, query);
+    for (int i = 0; i < passes; i++)
+        glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+    glEndQuery(GL_TIME_ELAPSED);
+
+    GLuint64 elapsed = 0;
+    glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+    glDeleteQueries(1, &query);
+    return elapsed / 1.0e6 / passes;
+}
+
+int main()
+{
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow* window = glfwCreateWindow(64, 64, "NormalMatrixBench", NULL, NULL);
+    if (window == NULL)
+    {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+
+    // Около 3 миллионов вершин (миллион треугольников): позиция + нормаль
+    const unsigned int vertexCount = 3 * (1 << 20);
+    std::vector<float> data(vertexCount * 6);
+    for (unsigned int i = 0; i < vertexCount; i++)
+    {
+        data[i * 6 + 0] = (float)(i % 1024) * 0.01f;
+        data[i * 6 + 1] = (float)((i / 1024) % 1024) * 0.01f;
+        data[i * 6 + 2] = -5.0f;
+        data[i * 6 + 3] = 0.0f;
+        data[i * 6 + 4] = 1.0f;
+        data[i * 6 + 5] = 0.0f;
+    }
+
+    unsigned int VAO, VBO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), data.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    // Окно просмотра 1x1: растеризация и фрагментная стадия почти ничего не стоят
+    glViewport(0, 0, 1, 1);
+
+    unsigned int inverseProgram = compileProgram(vertexInverse, fragmentSource);
+    unsigned int uniformProgram = compileProgram(vertexUniform, fragmentSource);
+
+    const int passes = 20;
+    double inverseMs = measure(inverseProgram, vertexCount, false, passes);
+    double uniformMs = measure(uniformProgram, vertexCount, true, passes);
+
+    std::cout << "vertices per pass:       " << vertexCount << std::endl;
+    std::cout << "inverse() per vertex:    " << inverseMs << " ms" << std::endl;
+    std::cout << "normalMatrix uniform:    " << uniformMs << " ms" << std::endl;
+    if (uniformMs > 0.0)
+        std::cout << "speedup:                 " << inverseMs / uniformMs << "x" << std::endl;
+
+    glDeleteProgram(inverseProgram);
+    glDeleteProgram(uniformProgram);
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+
+    glfwTerminate();
+    return 0;
+}
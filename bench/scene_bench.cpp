@@ -0,0 +1,447 @@
+// Детерминированный бенчмарк облета мира из кубов.
+// Прогоняет заданную траекторию камеры с фиксированным шагом по трем мирам (участок 40x40,
+// полная карта 256x256 и процедурно расширенный мир 1024x1024), собирает время кадра CPU и GPU,
+// число вызовов рисования, треугольников и пиковую память, и сравнивает их с сохраненными базовыми значениями.
+// Заодно проверяется, что Model::Draw не выделяет память в куче: после первого кадра любое выделение
+// внутри отрисовки моделей считается ошибкой, и что при импорте сферы строятся уровни детализации
+// с убывающим числом треугольников. Четвертая сцена - участок 40x40 со скелетно анимированными щупальцами
+// (Model::DrawAnimated).
+//
+// Запуск из каталога сборки:
+//   Lesson1Bench [--window] [--output results.json] [--path file.path]
+//                [--baseline ../bench/baseline.txt] [--thresholds ../bench/thresholds.txt] [--write-baseline] [--no-check]
+// Код возврата 1, если хотя бы одна метрика ухудшилась сильнее допустимого порога, отрисовка модели выделяла память,
+// уровни детализации не построены или базовых значений нет. Базовые значения зависят от машины, поэтому в репозитории их нет: на машине, где
+// бенчмарк проверяет регрессии, их один раз записывают через --write-baseline. --no-check только выводит метрики
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../src/shader.h"
+#include "../src/camera.h"
+#include "../src/camera_path.h"
+#include "../src/window.h"
+#include "../src/cube.h"
+#include "../src/world.h"
+#include "../src/lighting.h"
+#include "../src/transform.h"
+#include "../src/model.h"
+#include "../src/gpu_profiler.h"
+#include "../src/benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Обработчики событий окна объявлены в window.h; в бенчмарке ввод не используется
+void framebuffer_size_callback(GLFWwindow* window, int width, int height) {}
+void mouse_callback(GLFWwindow* window, double xpos, double ypos) {}
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset) {}
+
+// Счетчик выделений памяти: глобальные operator new/delete заменены во всей программе
+static std::atomic<unsigned long long> allocationCount{ 0 };
+
+void* operator new(std::size_t size)
+{
+    allocationCount++;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+const int BENCH_WIDTH = 800;
+const int BENCH_HEIGHT = 600;
+const float TIME_STEP = 1.0f / 60.0f;
+const float VIEW_DISTANCE = 100.0f; // совпадает с дальней плоскостью отсечения
+const int PROP_SPACING = 16;        // ящики стоят на каждом 16-м столбце по обеим осям
+const int SCATTER_SPACING = 4;      // мелкие ящики (экземпляры) - на каждом 4-м
+const int TENTACLE_SPACING = 2;     // анимированные щупальца - на каждом 2-м (400 штук на участке 40x40)
+
+struct Scene {
+    std::string name;
+    World world;
+    std::vector<Instance> props;
+    std::vector<glm::mat4> stack;
+    std::vector<glm::mat4> tentacles;          // пусто, если в сцене нет анимированных моделей
+    std::vector<AnimationState> tentacleStates;
+};
+
+// Штабель больших ящиков в центре мира. Его рисует та же модель, что и ящики на столбцах, но instanced-программой,
+// так что в кадре у мешей две программы и проверка выделений памяти покрывает смену программы
+static std::vector<glm::mat4> crateStack(const World& world)
+{
+    std::vector<glm::mat4> stack;
+    int x = world.width / 2, z = world.depth / 2;
+    for (int level = 0; level < 4; level++)
+        stack.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(x + 0.5f, world.height(x, z) + level, z + 0.5f)));
+    return stack;
+}
+
+// Щупальца на столбцах с разными фазами анимации, чтобы экземпляры не двигались синхронно
+static void plantTentacles(Scene& scene)
+{
+    const World& world = scene.world;
+    for (int x = 0; x < world.width; x += TENTACLE_SPACING)
+    {
+        for (int z = 0; z < world.depth; z += TENTACLE_SPACING)
+        {
+            scene.tentacles.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(x + 0.5f, world.height(x, z), z + 0.5f)));
+            AnimationState state;
+            state.time = (float)((x * 37 + z * 11) % 100) / 50.0f;
+            scene.tentacleStates.push_back(state);
+        }
+    }
+}
+
+// Мелкие ящики, разбросанные по всему миру с детерминированными поворотами
+static std::vector<Instance> scatterProps(const World& world)
+{
+    std::vector<Instance> props;
+    for (int x = 0; x < world.width; x += SCATTER_SPACING)
+    {
+        for (int z = 0; z < world.depth; z += SCATTER_SPACING)
+        {
+            Instance instance;
+            instance.scale = 0.4f;
+            instance.position = glm::vec3(x + 0.5f, world.height(x, z) - 0.3f, z + 0.5f);
+            float angle = (float)((x * 73 + z * 151) % 360);
+            instance.rotation = glm::angleAxis(glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f));
+            props.push_back(instance);
+        }
+    }
+    return props;
+}
+
+// Файл "имя значение" (базовые значения или пороги); строки, начинающиеся с #, пропускаются
+static std::map<std::string, double> readValues(const std::string& path)
+{
+    std::map<std::string, double> values;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::istringstream in(line);
+        std::string name;
+        double value;
+        if (in >> name >> value)
+            values[name] = value;
+    }
+    return values;
+}
+
+int main(int argc, char* argv[])
+{
+    bool headless = true;
+    bool writeBaseline = false, check = true;
+    std::string outputPath, pathFile = "../bench/flyover.path";
+    std::string baselinePath = "../bench/baseline.txt", thresholdsPath = "../bench/thresholds.txt";
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--window")
+            headless = false;
+        else if (arg == "--write-baseline")
+            writeBaseline = true;
+        else if (arg == "--no-check")
+            check = false;
+        else if (arg == "--output" && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (arg == "--path" && i + 1 < argc)
+            pathFile = argv[++i];
+        else if (arg == "--baseline" && i + 1 < argc)
+            baselinePath = argv[++i];
+        else if (arg == "--thresholds" && i + 1 < argc)
+            thresholdsPath = argv[++i];
+    }
+
+    if (Window::initialize(BENCH_WIDTH, BENCH_HEIGHT, "Lesson1Bench", headless) != 0)
+        return -1;
+    glfwSwapInterval(0);
+    glEnable(GL_DEPTH_TEST);
+
+    Shader lightingShader("../src/shaders/multiple_lights.vs", "../src/shaders/multiple_lights.fs");
+    Shader modelShader("../src/shaders/model_loading.vs", "../src/shaders/model_loading.fs");
+    Shader instancedShader("../src/shaders/model_packed_instanced.vs", "../src/shaders/model_loading.fs");
+    Shader stackShader("../src/shaders/model_instanced.vs", "../src/shaders/model_loading.fs");
+    Shader skinnedShader("../src/shaders/model_skinned_instanced.vs", "../src/shaders/model_loading.fs");
+
+    unsigned int VBO, cubeVAO;
+    glGenVertexArrays(1, &cubeVAO);
+    glGenBuffers(1, &VBO);
+    gpuResources().add(GpuResources::VertexArray, cubeVAO, "cube");
+    gpuResources().addBuffer(VBO, GL_ARRAY_BUFFER, sizeof(cubeVertices), "cube");
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
+    glBindVertexArray(cubeVAO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+
+    textureCache().setSrgbEnabled(Window::srgb);
+    unsigned int grassBlock = TextureFromFile("grass_block.png", "../res/textures", true);
+    Model crate("../res/objects/crate/crate.obj");
+    // Мелкие ящики рисуются из сжатых вершин (PackedVertex)
+    Model packedCrate("../res/objects/crate/crate.obj", false, true, nullptr, VertexFormat::Packed);
+    // Щупальце из четырех костей с циклической анимацией
+    Model tentacle("../res/objects/tentacle/tentacle.dae");
+    std::cout << "Crate vertex memory: " << crate.geometry->vertexBytes() << " bytes full, "
+              << packedCrate.geometry->vertexBytes() << " bytes packed" << std::endl;
+
+    // Уровни детализации сферы (OBJ: Assimp создает отдельную вершину для каждого угла треугольника,
+    // так что проверяется и слияние вершин перед упрощением): каждый уровень меньше предыдущего
+    bool lodsValid;
+    {
+        Model sphere("../res/objects/sphere/sphere.obj");
+        lodsValid = sphere.lodCount() > 1;
+        std::cout << "Sphere LOD triangles:";
+        for (int lod = 0; lod < sphere.lodCount(); lod++)
+        {
+            std::cout << " " << sphere.lodTriangles(lod);
+            if (lod > 0 && sphere.lodTriangles(lod) >= sphere.lodTriangles(lod - 1))
+                lodsValid = false;
+        }
+        std::cout << std::endl;
+        sphere.release();
+    }
+    if (!lodsValid)
+        std::cout << "ERROR::BENCHMARK::NO_LODS sphere.obj LOD triangle counts do not decrease" << std::endl;
+
+    glm::vec3 pointLightPositions[] = {
+        glm::vec3(0.7f,  0.2f,  2.0f),
+        glm::vec3(2.3f, -3.3f, -4.0f),
+        glm::vec3(-4.0f,  2.0f, -12.0f),
+        glm::vec3(0.0f,  0.0f, -3.0f)
+    };
+
+    // Заранее подготовленные миры трех размеров. Карта высот читается без переворота (Heightmap::load сбрасывает
+    // флаг stb_image потока, оставшийся от загрузки текстур), то есть в той же ориентации, что и в Lesson1
+    World heightmap = World::fromHeightmap("../res/textures/heightmap.png", 256, 256);
+    World patch(40, 40);
+    for (int x = 0; x < 40; x++)
+        for (int z = 0; z < 40; z++)
+            patch.setHeight(x, z, heightmap.height(x, z));
+    World extended = World::extended(heightmap, 1024, 1024);
+    std::vector<Scene> scenes = {
+        { "patch40", patch, scatterProps(patch), crateStack(patch), {}, {} },
+        { "heightmap256", heightmap, scatterProps(heightmap), crateStack(heightmap), {}, {} },
+        { "extended1024", extended, scatterProps(extended), crateStack(extended), {}, {} },
+        { "skinned40", patch, scatterProps(patch), crateStack(patch), {}, {} },
+    };
+    plantTentacles(scenes.back());
+    if (tentacle.skeleton.empty() || tentacle.animations.empty())
+        std::cout << "ERROR::BENCHMARK::NO_ANIMATION tentacle.dae has no skeleton or animation" << std::endl;
+
+    // Записанная траектория (F5 в Lesson1) рассчитана на участок 40x40 и растягивается под размер мира
+    CameraPath basePath;
+    if (!CameraPath::load(pathFile, basePath))
+    {
+        std::cout << "Camera path " << pathFile << " not found, using the built-in flyover" << std::endl;
+        basePath = CameraPath::flyover();
+    }
+
+    GpuProfiler gpuProfiler;
+    int framePass = gpuProfiler.addPass("frame");
+
+    unsigned long long drawAllocations = 0;
+    std::map<std::string, double> results;
+    std::ostringstream json;
+    json << "[\n";
+    for (size_t s = 0; s < scenes.size(); s++)
+    {
+        Scene& scene = scenes[s];
+        CameraPath path = basePath.scaled(glm::min(scene.world.width / 40.0f, 4.0f));
+        Camera camera;
+        BenchmarkRunner benchmark;
+
+        int frame = 0;
+        for (float t = 0.0f; t <= path.duration(); t += TIME_STEP, frame++)
+        {
+            benchmark.beginFrame();
+            gpuProfiler.beginFrame();
+            textureStreamer().update();
+            path.apply(camera, t);
+            {
+                GpuProfiler::Scope scope(gpuProfiler, framePass);
+                glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+                lightingShader.use();
+                lightingShader.setInt("material.diffuse", 0);
+                lightingShader.setInt("material.specular", 1);
+                setSceneLights(lightingShader, pointLightPositions, camera, Window::srgb);
+
+                glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)BENCH_WIDTH / (float)BENCH_HEIGHT, 0.1f, VIEW_DISTANCE);
+                lightingShader.setMat4("projection", projection);
+                lightingShader.setMat4("view", camera.GetViewMatrix());
+                lightingShader.setMat3("normalMatrix", NormalMatrix(glm::mat4(1.0f)));
+
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, grassBlock);
+                samplerCache().bind(0);
+                glBindVertexArray(cubeVAO);
+
+                // Рисуем столбцы в пределах дальности видимости вокруг камеры
+                int cx = (int)camera.Position.x, cz = (int)camera.Position.z, r = (int)VIEW_DISTANCE;
+                scene.world.draw(lightingShader, cx - r, cz - r, cx + r, cz + r);
+
+                // Ящики на вершинах столбцов
+                modelShader.use();
+                modelShader.setMat4("projection", projection);
+                modelShader.setMat4("view", camera.GetViewMatrix());
+                for (int x = std::max(0, cx - r) / PROP_SPACING * PROP_SPACING; x < std::min(scene.world.width, cx + r); x += PROP_SPACING)
+                {
+                    for (int z = std::max(0, cz - r) / PROP_SPACING * PROP_SPACING; z < std::min(scene.world.depth, cz + r); z += PROP_SPACING)
+                    {
+                        modelShader.setMat4("model", glm::translate(glm::mat4(1.0f), glm::vec3(x + 0.5f, scene.world.height(x, z), z + 0.5f)));
+                        unsigned long long before = allocationCount.load();
+                        crate.Draw(modelShader);
+                        if (frame > 0)
+                            drawAllocations += allocationCount.load() - before;
+                    }
+                }
+
+                // Штабель из той же модели, но другой программой
+                Frustum frustum = Frustum::fromMatrix(projection * camera.GetViewMatrix());
+                stackShader.use();
+                stackShader.setMat4("projection", projection);
+                stackShader.setMat4("view", camera.GetViewMatrix());
+                unsigned long long before = allocationCount.load();
+                crate.DrawInstanced(stackShader, scene.stack.data(), scene.stack.size(), frustum);
+                if (frame > 0)
+                    drawAllocations += allocationCount.load() - before;
+
+                // Мелкие ящики instanced-вызовами с отсечением по пирамиде видимости и выбором уровня детализации
+                instancedShader.use();
+                instancedShader.setMat4("projection", projection);
+                instancedShader.setMat4("view", camera.GetViewMatrix());
+                before = allocationCount.load();
+                LodView lodView(camera.Position, projection, (float)BENCH_HEIGHT);
+                packedCrate.DrawInstanced(instancedShader, scene.props.data(), scene.props.size(), frustum, &lodView);
+                if (frame > 0)
+                    drawAllocations += allocationCount.load() - before;
+
+                // Анимированные щупальца. В проверку выделений памяти не входят: палитры считаются в пуле потоков,
+                // а ThreadPool::parallelFor выделяет память под задачу в каждом вызове
+                if (!scene.tentacles.empty())
+                {
+                    for (AnimationState& state : scene.tentacleStates)
+                        state.time += TIME_STEP;
+                    skinnedShader.use();
+                    skinnedShader.setMat4("projection", projection);
+                    skinnedShader.setMat4("view", camera.GetViewMatrix());
+                    tentacle.DrawAnimated(skinnedShader, scene.tentacles.data(), scene.tentacleStates.data(), scene.tentacles.size(), frustum);
+                }
+            }
+            gpuProfiler.endFrame();
+            Window::swapBuffers();
+            glfwPollEvents();
+            // Кадр все равно дожидается GPU (glFinish в BenchmarkRunner::endFrame), поэтому запросы читаются сразу:
+            // время GPU относится к этому же кадру, а не к кадру FRAMES_IN_FLIGHT назад или к предыдущей сцене
+            gpuProfiler.drain();
+            benchmark.endFrame(gpuProfiler.latest(framePass));
+        }
+
+        json << (s ? ",\n" : "");
+        benchmark.writeJson(json, scene.name);
+        for (const auto& metric : benchmark.metrics())
+            results[scene.name + "." + metric.first] = metric.second;
+        std::cout << scene.name << ": p50 " << benchmark.percentile(50.0) << " ms, p95 " << benchmark.percentile(95.0)
+                  << " ms, p99 " << benchmark.percentile(99.0) << " ms, " << benchmark.meanDrawCalls() << " draw calls" << std::endl;
+    }
+    json << "]\n";
+
+    if (outputPath.empty())
+        std::cout << json.str();
+    else
+    {
+        std::ofstream file(outputPath);
+        file << json.str();
+    }
+
+    if (drawAllocations)
+        std::cout << "ERROR::BENCHMARK::DRAW_ALLOCATIONS Model::Draw allocated " << drawAllocations << " time(s) after the first frame" << std::endl;
+
+    gpuProfiler.release();
+    crate.release();
+    packedCrate.release();
+    tentacle.release();
+    gpuResources().remove(GpuResources::VertexArray, cubeVAO);
+    gpuResources().remove(GpuResources::Buffer, VBO);
+    glDeleteVertexArrays(1, &cubeVAO);
+    glDeleteBuffers(1, &VBO);
+    textureCache().release();
+    samplerCache().release();
+    glDeleteProgram(lightingShader.ID);
+    glDeleteProgram(modelShader.ID);
+    glDeleteProgram(instancedShader.ID);
+    glDeleteProgram(stackShader.ID);
+    glDeleteProgram(skinnedShader.ID);
+    Window::terminate();
+
+    if (writeBaseline)
+    {
+        std::ofstream file(baselinePath);
+        file << "# Базовые значения Lesson1Bench: <сцена>.<метрика> <значение>\n";
+        for (const auto& result : results)
+            file << result.first << ' ' << result.second << '\n';
+        std::cout << "Baseline written to " << baselinePath << std::endl;
+        return drawAllocations || !lodsValid ? 1 : 0;
+    }
+
+    // Сравнение с базовыми значениями: все метрики таковы, что больше - хуже.
+    // Порог задается относительным допуском для метрики ("frame_ms_p95 0.15" - не более чем на 15% хуже)
+    std::map<std::string, double> baseline = readValues(baselinePath);
+    std::map<std::string, double> thresholds = readValues(thresholdsPath);
+    if (!check)
+        return drawAllocations || !lodsValid ? 1 : 0;
+    if (baseline.empty() || thresholds.empty())
+    {
+        std::cout << "ERROR::BENCHMARK::NO_BASELINE cannot read " << (baseline.empty() ? baselinePath : thresholdsPath)
+                  << " (record baseline values with --write-baseline or run with --no-check)" << std::endl;
+        return 1;
+    }
+
+    int regressions = 0;
+    for (const auto& result : results)
+    {
+        std::string metric = result.first.substr(result.first.find('.') + 1);
+        auto base = baseline.find(result.first);
+        auto threshold = thresholds.find(metric);
+        if (base == baseline.end() || threshold == thresholds.end())
+            continue;
+        double limit = base->second * (1.0 + threshold->second);
+        if (result.second > limit)
+        {
+            std::cout << "REGRESSION " << result.first << ": " << result.second << " > " << limit
+                      << " (baseline " << base->second << ")" << std::endl;
+            regressions++;
+        }
+    }
+    std::cout << (regressions ? "FAILED: " : "OK: ") << regressions << " regression(s)" << std::endl;
+    return regressions || drawAllocations || !lodsValid ? 1 : 0;
+}
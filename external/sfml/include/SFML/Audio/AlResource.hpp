@@ -1,70 +0,0 @@
-////////////////////////////////////////////////////////////
-//
-// SFML - Simple and Fast Multimedia Library
-// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
-//
-// This software is provided 'as-is', without any express or implied warranty.
-// In no event will the authors be held liable for any damages arising from the use of this software.
-//
-// Permission is granted to anyone to use this software for any purpose,
-// including commercial applications, and to alter it and redistribute it freely,
-// subject to the following restrictions:
-//
-// 1. The origin of this software must not be misrepresented;
-//    you must not claim that you wrote the original software.
-//    If you use this software in a product, an acknowledgment
-//    in the product documentation would be appreciated but is not required.
-//
-// 2. Altered source versions must be plainly marked as such,
-//    and must not be misrepresented as being the original software.
-//
-// 3. This notice may not be removed or altered from any source distribution.
-//
-////////////////////////////////////////////////////////////
-
-#ifndef SFML_ALRESOURCE_HPP
-#define SFML_ALRESOURCE_HPP
-
-////////////////////////////////////////////////////////////
-// Headers
-////////////////////////////////////////////////////////////
-#include <SFML/Audio/Export.hpp>
-
-
-namespace sf
-{
-////////////////////////////////////////////////////////////
-/// \brief Base class for classes that require an OpenAL context
-///
-////////////////////////////////////////////////////////////
-class SFML_AUDIO_API AlResource
-{
-protected:
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Default constructor
-    ///
-    ////////////////////////////////////////////////////////////
-    AlResource();
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Destructor
-    ///
-    ////////////////////////////////////////////////////////////
-    ~AlResource();
-};
-
-} // namespace sf
-
-
-#endif // SFML_ALRESOURCE_HPP
-
-////////////////////////////////////////////////////////////
-/// \class sf::AlResource
-/// \ingroup audio
-///
-/// This class is for internal use only, it must be the base
-/// of every class that requires a valid OpenAL context in
-/// order to work.
-///
-////////////////////////////////////////////////////////////
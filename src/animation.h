@@ -0,0 +1,291 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <assimp/scene.h>
+
+#include "gpu_resources.h"
+
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Скелетная анимация: иерархия узлов сцены, кости мешей и ключевые кадры aiAnimation.
+// Палитра костей (матрица для каждой кости) вычисляется на CPU, загружается в буфер текстуры (TBO)
+// и применяется в вершинном шейдере (shaders/model_skinned_instanced.vs)
+
+// Матрица Assimp (по строкам) -> glm (по столбцам)
+inline glm::mat4 toGlm(const aiMatrix4x4& m)
+{
+    return glm::transpose(glm::make_mat4(&m.a1));
+}
+
+// Иерархия узлов в порядке обхода в глубину: родитель всегда раньше потомков,
+// поэтому глобальные матрицы считаются одним проходом по массиву
+struct Skeleton
+{
+    // Индекс кости хранится в вершине одним байтом
+    static const unsigned int MAX_BONES = 256;
+
+    struct Node {
+        std::string name;
+        int parent;               // -1 у корня
+        glm::mat4 localTransform; // трансформация узла в позе привязки
+    };
+    struct Bone {
+        int node;
+        glm::mat4 offset; // из пространства меша в пространство кости
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Bone> bones;
+    std::unordered_map<std::string, int> nodeIndex;
+    std::unordered_map<std::string, unsigned int> boneIndex;
+    glm::mat4 globalInverse = glm::mat4(1.0f);
+
+    bool empty() const { return bones.empty(); }
+
+    // Узлы сцены и кости всех мешей. Возвращает false, если костей больше MAX_BONES
+    bool build(const aiScene* scene)
+    {
+        addNode(scene->mRootNode, -1);
+        globalInverse = glm::inverse(nodes[0].localTransform);
+        for (unsigned int m = 0; m < scene->mNumMeshes; m++)
+        {
+            const aiMesh* mesh = scene->mMeshes[m];
+            for (unsigned int b = 0; b < mesh->mNumBones; b++)
+            {
+                const aiBone* bone = mesh->mBones[b];
+                std::string name = bone->mName.C_Str();
+                auto node = nodeIndex.find(name);
+                if (boneIndex.count(name) || node == nodeIndex.end())
+                    continue;
+                if (bones.size() >= MAX_BONES)
+                    return false;
+                boneIndex[name] = (unsigned int)bones.size();
+                bones.push_back({ node->second, toGlm(bone->mOffsetMatrix) });
+            }
+        }
+        return true;
+    }
+
+private:
+    void addNode(const aiNode* node, int parent)
+    {
+        int index = (int)nodes.size();
+        nodes.push_back({ node->mName.C_Str(), parent, toGlm(node->mTransformation) });
+        nodeIndex[nodes.back().name] = index;
+        for (unsigned int i = 0; i < node->mNumChildren; i++)
+            addNode(node->mChildren[i], index);
+    }
+};
+
+// Анимация: ключевые кадры трансляции, поворота и масштаба для узлов скелета
+struct AnimationClip
+{
+    template <typename T>
+    struct Key {
+        float time;
+        T value;
+    };
+    struct Channel {
+        std::vector<Key<glm::vec3>> positions;
+        std::vector<Key<glm::quat>> rotations;
+        std::vector<Key<glm::vec3>> scales;
+    };
+
+    std::string name;
+    float duration = 0.0f;        // в тиках
+    float ticksPerSecond = 25.0f;
+    std::vector<Channel> channels;
+    std::vector<int> nodeChannel; // канал каждого узла скелета или -1 (узел остается в позе привязки)
+
+    AnimationClip(const aiAnimation* animation, const Skeleton& skeleton)
+        : name(animation->mName.C_Str()), duration((float)animation->mDuration),
+          nodeChannel(skeleton.nodes.size(), -1)
+    {
+        if (animation->mTicksPerSecond > 0.0)
+            ticksPerSecond = (float)animation->mTicksPerSecond;
+        for (unsigned int i = 0; i < animation->mNumChannels; i++)
+        {
+            const aiNodeAnim* source = animation->mChannels[i];
+            auto node = skeleton.nodeIndex.find(source->mNodeName.C_Str());
+            if (node == skeleton.nodeIndex.end())
+                continue;
+            Channel channel;
+            for (unsigned int k = 0; k < source->mNumPositionKeys; k++)
+            {
+                const aiVectorKey& key = source->mPositionKeys[k];
+                channel.positions.push_back({ (float)key.mTime, glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z) });
+            }
+            for (unsigned int k = 0; k < source->mNumRotationKeys; k++)
+            {
+                const aiQuatKey& key = source->mRotationKeys[k];
+                channel.rotations.push_back({ (float)key.mTime, glm::quat(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z) });
+            }
+            for (unsigned int k = 0; k < source->mNumScalingKeys; k++)
+            {
+                const aiVectorKey& key = source->mScalingKeys[k];
+                channel.scales.push_back({ (float)key.mTime, glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z) });
+            }
+            nodeChannel[node->second] = (int)channels.size();
+            channels.push_back(std::move(channel));
+        }
+    }
+
+    // Длительность в секундах
+    float seconds() const { return duration / ticksPerSecond; }
+};
+
+// Вычисление палитры костей для одного анимированного объекта. Для каждого канала хранятся курсоры -
+// номера текущих ключевых кадров. Время анимации обычно растет понемногу, поэтому курсор сдвигается
+// на 0-1 кадр вместо двоичного поиска в каждом кадре; при переходе через начало (зацикливание или
+// смена клипа) курсоры сбрасываются. У каждого объекта свой сэмплер, поэтому объекты можно
+// анимировать параллельно в разных потоках
+class AnimationSampler
+{
+public:
+    // Палитра клипа clip в момент seconds (с зацикливанием): skeleton.bones.size() матриц в palette
+    void sample(const AnimationClip& clip, float seconds, const Skeleton& skeleton, glm::mat4* palette)
+    {
+        float ticks = clip.duration > 0.0f ? std::fmod(seconds * clip.ticksPerSecond, clip.duration) : 0.0f;
+        if (ticks < 0.0f)
+            ticks += clip.duration;
+        if (&clip != lastClip || ticks < lastTicks)
+        {
+            cursors.assign(clip.channels.size(), Cursor());
+            lastClip = &clip;
+        }
+        lastTicks = ticks;
+
+        globals.resize(skeleton.nodes.size());
+        for (size_t n = 0; n < skeleton.nodes.size(); n++)
+        {
+            const Skeleton::Node& node = skeleton.nodes[n];
+            int channel = clip.nodeChannel[n];
+            glm::mat4 local = channel >= 0 ? sampleChannel(clip.channels[channel], cursors[channel], ticks) : node.localTransform;
+            globals[n] = node.parent >= 0 ? globals[node.parent] * local : local;
+        }
+        for (size_t b = 0; b < skeleton.bones.size(); b++)
+            palette[b] = skeleton.globalInverse * globals[skeleton.bones[b].node] * skeleton.bones[b].offset;
+    }
+
+private:
+    struct Cursor {
+        size_t position = 0, rotation = 0, scale = 0;
+    };
+
+    std::vector<Cursor> cursors;
+    std::vector<glm::mat4> globals; // глобальные матрицы узлов (переиспользуются между кадрами)
+    const AnimationClip* lastClip = nullptr;
+    float lastTicks = 0.0f;
+
+    // Сдвиг курсора к последнему кадру не позже ticks; t - доля пути до следующего кадра
+    template <typename T>
+    static const AnimationClip::Key<T>* advance(const std::vector<AnimationClip::Key<T>>& keys, size_t& cursor, float ticks, float& t)
+    {
+        while (cursor + 1 < keys.size() && keys[cursor + 1].time <= ticks)
+            cursor++;
+        t = 0.0f;
+        if (cursor + 1 < keys.size())
+        {
+            float span = keys[cursor + 1].time - keys[cursor].time;
+            t = span > 0.0f ? glm::clamp((ticks - keys[cursor].time) / span, 0.0f, 1.0f) : 0.0f;
+        }
+        return &keys[cursor];
+    }
+
+    static glm::mat4 sampleChannel(const AnimationClip::Channel& channel, Cursor& cursor, float ticks)
+    {
+        float t;
+        glm::vec3 position(0.0f), scale(1.0f);
+        glm::quat rotation(1.0f, 0.0f, 0.0f, 0.0f);
+        if (!channel.positions.empty())
+        {
+            const AnimationClip::Key<glm::vec3>* key = advance(channel.positions, cursor.position, ticks, t);
+            position = t > 0.0f ? glm::mix(key[0].value, key[1].value, t) : key[0].value;
+        }
+        if (!channel.rotations.empty())
+        {
+            const AnimationClip::Key<glm::quat>* key = advance(channel.rotations, cursor.rotation, ticks, t);
+            rotation = t > 0.0f ? glm::slerp(key[0].value, key[1].value, t) : key[0].value;
+        }
+        if (!channel.scales.empty())
+        {
+            const AnimationClip::Key<glm::vec3>* key = advance(channel.scales, cursor.scale, ticks, t);
+            scale = t > 0.0f ? glm::mix(key[0].value, key[1].value, t) : key[0].value;
+        }
+        glm::mat4 m = glm::mat4_cast(glm::normalize(rotation));
+        m[0] *= scale.x;
+        m[1] *= scale.y;
+        m[2] *= scale.z;
+        m[3] = glm::vec4(position, 1.0f);
+        return m;
+    }
+};
+
+// Состояние анимированного экземпляра: клип, время и собственный сэмплер
+struct AnimationState {
+    int clip = 0;
+    float time = 0.0f; // в секундах
+    AnimationSampler sampler;
+};
+
+// Палитры костей рисуемых экземпляров в буфере текстуры (GL_RGBA32F, четыре текселя на матрицу).
+// Шейдер читает матрицу кости bone экземпляра gl_InstanceID через texelFetch. Вызывающий код не загружает
+// больше GL_MAX_TEXTURE_BUFFER_SIZE текселей за раз (см. Model::DrawAnimated)
+class BonePaletteBuffer
+{
+public:
+    // Текстурный юнит палитры: младшие юниты заняты текстурами материалов
+    static const unsigned int TEXTURE_UNIT = 15;
+
+    BonePaletteBuffer()
+    {
+        glGenBuffers(1, &TBO);
+        glGenTextures(1, &texture);
+        gpuResources().addBuffer(TBO, GL_TEXTURE_BUFFER, 0, "bone palettes");
+        // Текстура - только представление буфера, своей памяти у неё нет
+        gpuResources().add(GpuResources::Texture, texture, "bone palettes");
+        gpuResources().setTexture(texture, 0, 0, GL_RGBA32F, 1, 0);
+    }
+
+    // Загрузка count матриц. Буфер пересоздается (orphaning), как и буфер экземпляров
+    void upload(const glm::mat4* palettes, size_t count)
+    {
+        if (count > capacity)
+        {
+            capacity = count + count / 2;
+            gpuResources().resize(GpuResources::Buffer, TBO, capacity * sizeof(glm::mat4));
+        }
+        glBindBuffer(GL_TEXTURE_BUFFER, TBO);
+        glBufferData(GL_TEXTURE_BUFFER, capacity * sizeof(glm::mat4), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_TEXTURE_BUFFER, 0, count * sizeof(glm::mat4), palettes);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    void bind() const
+    {
+        glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT);
+        glBindTexture(GL_TEXTURE_BUFFER, texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, TBO);
+    }
+
+    void release()
+    {
+        gpuResources().remove(GpuResources::Texture, texture);
+        gpuResources().remove(GpuResources::Buffer, TBO);
+        glDeleteTextures(1, &texture);
+        glDeleteBuffers(1, &TBO);
+        texture = TBO = 0;
+    }
+
+private:
+    unsigned int TBO = 0, texture = 0;
+    size_t capacity = 0;
+};
+#endif
@@ -0,0 +1,195 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <glad/glad.h>
+
+#include "render_stats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <unistd.h>
+#endif
+
+// Объем физической памяти, занятой процессом (resident set size), в байтах
+inline size_t currentMemoryUsage()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return counters.WorkingSetSize;
+    return 0;
+#else
+    long pages = 0, resident = 0;
+    FILE* file = std::fopen("/proc/self/statm", "r");
+    if (!file)
+        return 0;
+    if (std::fscanf(file, "%ld %ld", &pages, &resident) != 2)
+        resident = 0;
+    std::fclose(file);
+    return (size_t)resident * (size_t)sysconf(_SC_PAGESIZE);
+#endif
+}
+
+// Сбор метрик кадров для автоматических бенчмарков. Время кадра измеряется по стенным часам
+// от начала кадра до glFinish, поэтому включает работу GPU (или программного растеризатора)
+class BenchmarkRunner
+{
+public:
+    struct FrameSample {
+        double ms;
+        double gpuMs;
+        unsigned int drawCalls;
+        unsigned long long triangles;
+    };
+
+    // Первые кадры (компиляция шейдеров, загрузка в драйвер) в статистику не попадают
+    explicit BenchmarkRunner(int warmupFrames = 10) : warmupFrames(warmupFrames) {}
+
+    void beginFrame()
+    {
+        renderStats().reset();
+        frameStart = std::chrono::steady_clock::now();
+    }
+
+    // gpuMs - время GPU из GpuProfiler (отрицательное значение, если оно не измерялось)
+    void endFrame(double gpuMs = -1.0)
+    {
+        glFinish();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        if (framesSeen++ < warmupFrames)
+            return;
+        samples.push_back({ ms, gpuMs, renderStats().drawCalls, renderStats().triangles });
+        peakMemory = std::max(peakMemory, currentMemoryUsage());
+    }
+
+    const std::vector<FrameSample>& frames() const { return samples; }
+
+    // Перцентиль времени кадра (p в диапазоне [0, 100]), методом ближайшего ранга
+    double percentile(double p) const
+    {
+        return percentileOf(p, [](const FrameSample& s) { return s.ms; });
+    }
+
+    double mean() const
+    {
+        return meanOf([](const FrameSample& s) { return s.ms; });
+    }
+
+    double meanGpu() const
+    {
+        return meanOf([](const FrameSample& s) { return s.gpuMs < 0.0 ? 0.0 : s.gpuMs; });
+    }
+
+    double meanDrawCalls() const
+    {
+        return meanOf([](const FrameSample& s) { return (double)s.drawCalls; });
+    }
+
+    double meanTriangles() const
+    {
+        return meanOf([](const FrameSample& s) { return (double)s.triangles; });
+    }
+
+    unsigned int maxDrawCalls() const
+    {
+        unsigned int result = 0;
+        for (const FrameSample& s : samples)
+            result = std::max(result, s.drawCalls);
+        return result;
+    }
+
+    double peakMemoryMb() const
+    {
+        return peakMemory / (1024.0 * 1024.0);
+    }
+
+    // Плоский список метрик "имя - значение" для сравнения с базовыми значениями
+    std::vector<std::pair<std::string, double>> metrics() const
+    {
+        return {
+            { "frame_ms_mean", mean() },
+            { "frame_ms_p50", percentile(50.0) },
+            { "frame_ms_p95", percentile(95.0) },
+            { "frame_ms_p99", percentile(99.0) },
+            { "gpu_ms_mean", meanGpu() },
+            { "draw_calls_mean", meanDrawCalls() },
+            { "triangles_mean", meanTriangles() },
+            { "memory_mb_peak", peakMemoryMb() },
+        };
+    }
+
+    // Результат в виде JSON для CI
+    void writeJson(std::ostream& out, const std::string& name) const
+    {
+        out << std::fixed << std::setprecision(3);
+        out << "{\n";
+        out << "  \"benchmark\": \"" << name << "\",\n";
+        out << "  \"frames\": " << samples.size() << ",\n";
+        out << "  \"frame_ms\": { \"mean\": " << mean() << ", \"p50\": " << percentile(50.0)
+            << ", \"p95\": " << percentile(95.0) << ", \"p99\": " << percentile(99.0) << " },\n";
+        out << "  \"gpu_ms\": { \"mean\": " << meanGpu() << " },\n";
+        out << "  \"draw_calls\": { \"mean\": " << meanDrawCalls() << ", \"max\": " << maxDrawCalls() << " },\n";
+        out << "  \"triangles\": { \"mean\": " << meanTriangles() << " },\n";
+        out << "  \"memory_mb\": { \"peak\": " << peakMemoryMb() << " }\n";
+        out << "}\n";
+    }
+
+    bool writeJson(const std::string& path, const std::string& name) const
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            std::cout << "ERROR::BENCHMARK::CANNOT_WRITE " << path << std::endl;
+            return false;
+        }
+        writeJson(file, name);
+        return true;
+    }
+
+private:
+    int warmupFrames;
+    int framesSeen = 0;
+    size_t peakMemory = 0;
+    std::chrono::steady_clock::time_point frameStart;
+    std::vector<FrameSample> samples;
+
+    template <typename F>
+    double meanOf(F value) const
+    {
+        double sum = 0.0;
+        for (const FrameSample& s : samples)
+            sum += value(s);
+        return samples.empty() ? 0.0 : sum / samples.size();
+    }
+
+    template <typename F>
+    double percentileOf(double p, F value) const
+    {
+        if (samples.empty())
+            return 0.0;
+        std::vector<double> sorted;
+        sorted.reserve(samples.size());
+        for (const FrameSample& s : samples)
+            sorted.push_back(value(s));
+        std::sort(sorted.begin(), sorted.end());
+        size_t rank = (size_t)std::ceil(p / 100.0 * sorted.size());
+        return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+    }
+};
+#endif
@@ -0,0 +1,261 @@
+#ifndef BLOCK_COMPRESSION_H
+#define BLOCK_COMPRESSION_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Сжатие текстур в блочные форматы BCn на CPU (для запекания, см. tools/texture_bake.cpp).
+// Изображение делится на блоки 4x4 пикселя; блок BC1/BC4 занимает 8 байт, BC3/BC5 - 16 байт:
+//   BC1 - RGB, два цвета 5:6:5 и 2-битные индексы (4 бита на пиксель)
+//   BC3 - BC1 для цвета и BC4 для альфа-канала (8 бит на пиксель)
+//   BC4 - один канал, два 8-битных значения и 3-битные индексы (4 бита на пиксель)
+//   BC5 - два канала BC4 (XY карты нормалей, 8 бит на пиксель)
+namespace BlockCompression
+{
+    enum Format { BC1, BC3, BC4, BC5 };
+
+    inline size_t blockBytes(Format format)
+    {
+        return format == BC1 || format == BC4 ? 8 : 16;
+    }
+
+    // Размер сжатого изображения width x height в байтах
+    inline size_t imageBytes(Format format, int width, int height)
+    {
+        return (size_t)((width + 3) / 4) * ((height + 3) / 4) * blockBytes(format);
+    }
+
+    inline uint16_t packColor565(const float c[3])
+    {
+        int r = (int)std::lround(std::min(std::max(c[0], 0.0f), 255.0f) * 31.0f / 255.0f);
+        int g = (int)std::lround(std::min(std::max(c[1], 0.0f), 255.0f) * 63.0f / 255.0f);
+        int b = (int)std::lround(std::min(std::max(c[2], 0.0f), 255.0f) * 31.0f / 255.0f);
+        return (uint16_t)(r << 11 | g << 5 | b);
+    }
+
+    inline void unpackColor565(uint16_t c, float out[3])
+    {
+        int r = c >> 11 & 31, g = c >> 5 & 63, b = c & 31;
+        out[0] = (float)(r << 3 | r >> 2);
+        out[1] = (float)(g << 2 | g >> 4);
+        out[2] = (float)(b << 3 | b >> 2);
+    }
+
+    // Палитра из четырех цветов BC1 (режим c0 > c1) и выбор ближайшего цвета для каждого пикселя.
+    // Возвращает суммарную квадратичную ошибку
+    inline float fitIndices(const float pixels[16][3], uint16_t c0, uint16_t c1, uint32_t& indices)
+    {
+        float palette[4][3];
+        unpackColor565(c0, palette[0]);
+        unpackColor565(c1, palette[1]);
+        for (int k = 0; k < 3; k++)
+        {
+            palette[2][k] = (2.0f * palette[0][k] + palette[1][k]) / 3.0f;
+            palette[3][k] = (palette[0][k] + 2.0f * palette[1][k]) / 3.0f;
+        }
+        float error = 0.0f;
+        indices = 0;
+        for (int i = 0; i < 16; i++)
+        {
+            int best = 0;
+            float bestDistance = 1e30f;
+            for (int p = 0; p < 4; p++)
+            {
+                float dr = pixels[i][0] - palette[p][0], dg = pixels[i][1] - palette[p][1], db = pixels[i][2] - palette[p][2];
+                float distance = dr * dr + dg * dg + db * db;
+                if (distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    best = p;
+                }
+            }
+            indices |= (uint32_t)best << (2 * i);
+            error += bestDistance;
+        }
+        return error;
+    }
+
+    // Запись блока BC1 в режиме четырех цветов (c0 > c1); при c0 < c1 концы меняются местами вместе с индексами
+    inline void writeColorBlock(uint16_t c0, uint16_t c1, uint32_t indices, unsigned char* out)
+    {
+        if (c0 < c1)
+        {
+            std::swap(c0, c1);
+            indices ^= 0x55555555u; // 0 <-> 1, 2 <-> 3
+        }
+        else if (c0 == c1)
+            indices = 0;
+        out[0] = (unsigned char)(c0 & 0xFF);
+        out[1] = (unsigned char)(c0 >> 8);
+        out[2] = (unsigned char)(c1 & 0xFF);
+        out[3] = (unsigned char)(c1 >> 8);
+        for (int i = 0; i < 4; i++)
+            out[4 + i] = (unsigned char)(indices >> (8 * i));
+    }
+
+    // Цветовой блок: концы отрезка - крайние проекции пикселей на главную ось распределения цветов,
+    // затем одна итерация уточнения концов методом наименьших квадратов по выбранным индексам
+    inline void encodeColorBlock(const unsigned char rgba[16 * 4], unsigned char* out)
+    {
+        float pixels[16][3];
+        float mean[3] = { 0.0f, 0.0f, 0.0f };
+        for (int i = 0; i < 16; i++)
+            for (int k = 0; k < 3; k++)
+            {
+                pixels[i][k] = rgba[i * 4 + k];
+                mean[k] += pixels[i][k] / 16.0f;
+            }
+
+        // Ковариация и главная ось (степенной метод)
+        float cov[6] = {};
+        for (int i = 0; i < 16; i++)
+        {
+            float r = pixels[i][0] - mean[0], g = pixels[i][1] - mean[1], b = pixels[i][2] - mean[2];
+            cov[0] += r * r; cov[1] += r * g; cov[2] += r * b;
+            cov[3] += g * g; cov[4] += g * b; cov[5] += b * b;
+        }
+        float axis[3] = { 1.0f, 1.0f, 1.0f };
+        for (int iteration = 0; iteration < 8; iteration++)
+        {
+            float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+            float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+            float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+            float length = std::max(std::max(std::fabs(x), std::fabs(y)), std::fabs(z));
+            if (length <= 0.0f)
+                break;
+            axis[0] = x / length;
+            axis[1] = y / length;
+            axis[2] = z / length;
+        }
+
+        float minProjection = 1e30f, maxProjection = -1e30f;
+        int minPixel = 0, maxPixel = 0;
+        for (int i = 0; i < 16; i++)
+        {
+            float projection = (pixels[i][0] - mean[0]) * axis[0] + (pixels[i][1] - mean[1]) * axis[1] + (pixels[i][2] - mean[2]) * axis[2];
+            if (projection < minProjection) { minProjection = projection; minPixel = i; }
+            if (projection > maxProjection) { maxProjection = projection; maxPixel = i; }
+        }
+        uint16_t c0 = packColor565(pixels[maxPixel]), c1 = packColor565(pixels[minPixel]);
+        uint32_t indices;
+        float error = fitIndices(pixels, c0, c1, indices);
+
+        // Наименьшие квадраты: пиксель i ~ a_i * e0 + b_i * e1, где (a_i, b_i) задаются индексом
+        static const float weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f, ax[3] = {}, bx[3] = {};
+        for (int i = 0; i < 16; i++)
+        {
+            float a = weights[indices >> (2 * i) & 3], b = 1.0f - a;
+            aa += a * a; ab += a * b; bb += b * b;
+            for (int k = 0; k < 3; k++)
+            {
+                ax[k] += a * pixels[i][k];
+                bx[k] += b * pixels[i][k];
+            }
+        }
+        float determinant = aa * bb - ab * ab;
+        if (std::fabs(determinant) > 1e-6f)
+        {
+            float e0[3], e1[3];
+            for (int k = 0; k < 3; k++)
+            {
+                e0[k] = (ax[k] * bb - bx[k] * ab) / determinant;
+                e1[k] = (bx[k] * aa - ax[k] * ab) / determinant;
+            }
+            uint16_t r0 = packColor565(e0), r1 = packColor565(e1);
+            uint32_t refinedIndices;
+            float refinedError = fitIndices(pixels, r0, r1, refinedIndices);
+            if (refinedError < error)
+            {
+                c0 = r0;
+                c1 = r1;
+                indices = refinedIndices;
+            }
+        }
+        writeColorBlock(c0, c1, indices, out);
+    }
+
+    // Одноканальный блок BC4 в режиме восьми значений: концы - минимум и максимум блока
+    inline void encodeChannelBlock(const unsigned char values[16], unsigned char* out)
+    {
+        int lo = 255, hi = 0;
+        for (int i = 0; i < 16; i++)
+        {
+            lo = std::min(lo, (int)values[i]);
+            hi = std::max(hi, (int)values[i]);
+        }
+        out[0] = (unsigned char)hi;
+        out[1] = (unsigned char)lo;
+        uint64_t indices = 0;
+        if (hi > lo)
+        {
+            // Значение индекса: 0 - hi, 1 - lo, 2..7 - (hi * (8 - k) + lo * (k - 1)) / 7
+            static const int order[8] = { 1, 7, 6, 5, 4, 3, 2, 0 }; // индекс по шагу от lo (0) до hi (7)
+            for (int i = 0; i < 16; i++)
+            {
+                int step = (int)std::lround((float)(values[i] - lo) * 7.0f / (float)(hi - lo));
+                indices |= (uint64_t)order[step] << (3 * i);
+            }
+        }
+        for (int i = 0; i < 6; i++)
+            out[2 + i] = (unsigned char)(indices >> (8 * i));
+    }
+
+    // Блок 4x4 из изображения RGBA8; пиксели за краем повторяют крайние
+    inline void fetchBlock(const unsigned char* rgba, int width, int height, int bx, int by, unsigned char block[16 * 4])
+    {
+        for (int y = 0; y < 4; y++)
+            for (int x = 0; x < 4; x++)
+            {
+                int sx = std::min(bx * 4 + x, width - 1), sy = std::min(by * 4 + y, height - 1);
+                std::memcpy(&block[(y * 4 + x) * 4], &rgba[((size_t)sy * width + sx) * 4], 4);
+            }
+    }
+
+    inline void encodeBlock(Format format, const unsigned char block[16 * 4], unsigned char* out)
+    {
+        unsigned char channel[16];
+        switch (format)
+        {
+        case BC1:
+            encodeColorBlock(block, out);
+            break;
+        case BC3:
+            for (int i = 0; i < 16; i++)
+                channel[i] = block[i * 4 + 3];
+            encodeChannelBlock(channel, out);
+            encodeColorBlock(block, out + 8);
+            break;
+        case BC4:
+            for (int i = 0; i < 16; i++)
+                channel[i] = block[i * 4];
+            encodeChannelBlock(channel, out);
+            break;
+        case BC5:
+            for (int c = 0; c < 2; c++)
+            {
+                for (int i = 0; i < 16; i++)
+                    channel[i] = block[i * 4 + c];
+                encodeChannelBlock(channel, out + 8 * c);
+            }
+            break;
+        }
+    }
+
+    // Сжатие строк блоков [firstRow, lastRow) изображения RGBA8 в out (imageBytes(format, width, height) байт)
+    inline void compressRows(Format format, const unsigned char* rgba, int width, int height, int firstRow, int lastRow, unsigned char* out)
+    {
+        int blocksX = (width + 3) / 4;
+        unsigned char block[16 * 4];
+        for (int by = firstRow; by < lastRow; by++)
+            for (int bx = 0; bx < blocksX; bx++)
+            {
+                fetchBlock(rgba, width, height, bx, by, block);
+                encodeBlock(format, block, out + ((size_t)by * blocksX + bx) * blockBytes(format));
+            }
+    }
+}
+#endif
@@ -287,6 +287,15 @@ public:
         updateCameraVectors();
     }
 
+    //       (     )
+    void SetPose(glm::vec3 position, float yaw, float pitch)
+    {
+        Position = position;
+        Yaw = yaw;
+        Pitch = pitch;
+        updateCameraVectors();
+    }
+
     //   ,      .         
     void ProcessMouseScroll(float yoffset)
     {
@@ -0,0 +1,108 @@
+#ifndef CAMERA_PATH_H
+#define CAMERA_PATH_H
+
+#include <glm/glm.hpp>
+
+#include "camera.h"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Заданная траектория камеры: ключевые кадры (время, позиция, углы Эйлера) с линейной интерполяцией.
+// Воспроизводится с фиксированным шагом времени, поэтому каждый прогон бенчмарка видит одни и те же кадры
+class CameraPath
+{
+public:
+    struct Key {
+        float time;
+        glm::vec3 position;
+        float yaw;
+        float pitch;
+    };
+
+    std::vector<Key> keys;
+
+    void add(float time, glm::vec3 position, float yaw, float pitch)
+    {
+        keys.push_back({ time, position, yaw, pitch });
+    }
+
+    float duration() const
+    {
+        return keys.empty() ? 0.0f : keys.back().time;
+    }
+
+    // Устанавливает камеру в точку траектории, соответствующую моменту времени t
+    void apply(Camera& camera, float t) const
+    {
+        if (keys.empty())
+            return;
+        if (t <= keys.front().time)
+        {
+            camera.SetPose(keys.front().position, keys.front().yaw, keys.front().pitch);
+            return;
+        }
+
+        size_t i = 1;
+        while (i < keys.size() - 1 && keys[i].time < t)
+            i++;
+        const Key& a = keys[i - 1];
+        const Key& b = keys[i];
+        float k = b.time > a.time ? glm::clamp((t - a.time) / (b.time - a.time), 0.0f, 1.0f) : 1.0f;
+        camera.SetPose(glm::mix(a.position, b.position, k), glm::mix(a.yaw, b.yaw, k), glm::mix(a.pitch, b.pitch, k));
+    }
+
+    // Траектория с позициями, растянутыми по горизонтали в factor раз (для миров большего размера).
+    // Время не меняется, поэтому число кадров прогона остается прежним
+    CameraPath scaled(float factor) const
+    {
+        CameraPath path;
+        for (const Key& key : keys)
+            path.add(key.time, glm::vec3(key.position.x * factor, key.position.y, key.position.z * factor), key.yaw, key.pitch);
+        return path;
+    }
+
+    // Текстовый формат: одна строка на ключевой кадр "время x y z рыскание тангаж"
+    bool save(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            std::cout << "ERROR::CAMERA_PATH::CANNOT_WRITE " << path << std::endl;
+            return false;
+        }
+        for (const Key& key : keys)
+            file << key.time << ' ' << key.position.x << ' ' << key.position.y << ' ' << key.position.z << ' ' << key.yaw << ' ' << key.pitch << '\n';
+        return true;
+    }
+
+    static bool load(const std::string& path, CameraPath& result)
+    {
+        std::ifstream file(path);
+        if (!file)
+            return false;
+        CameraPath loaded;
+        Key key;
+        while (file >> key.time >> key.position.x >> key.position.y >> key.position.z >> key.yaw >> key.pitch)
+            loaded.keys.push_back(key);
+        if (loaded.keys.empty())
+            return false;
+        result = loaded;
+        return true;
+    }
+
+    // Облет террейна 40x40: проход вдоль края, разворот над центром и взгляд сверху
+    static CameraPath flyover(float size = 40.0f)
+    {
+        CameraPath path;
+        path.add(0.0f, glm::vec3(2.0f, 20.0f, 2.0f), 45.0f, -30.0f);
+        path.add(4.0f, glm::vec3(size - 2.0f, 20.0f, 2.0f), 135.0f, -30.0f);
+        path.add(8.0f, glm::vec3(size - 2.0f, 25.0f, size - 2.0f), 225.0f, -35.0f);
+        path.add(12.0f, glm::vec3(size * 0.5f, 40.0f, size * 0.5f), 315.0f, -89.0f);
+        path.add(16.0f, glm::vec3(2.0f, 12.0f, size - 2.0f), 315.0f, -10.0f);
+        return path;
+    }
+};
+#endif
@@ -0,0 +1,54 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <glm/glm.hpp>
+
+// Пирамида видимости: шесть плоскостей, извлеченных из матрицы projection * view (метод Грибба-Хартманна).
+// Нормали плоскостей направлены внутрь, поэтому точка видима, если dot(plane.xyz, p) + plane.w >= 0 для всех плоскостей
+struct Frustum
+{
+    glm::vec4 planes[6];
+
+    static Frustum fromMatrix(const glm::mat4& viewProjection)
+    {
+        // Строки матрицы (glm хранит матрицы по столбцам)
+        glm::vec4 row[4];
+        for (int i = 0; i < 4; i++)
+            row[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+
+        Frustum frustum;
+        frustum.planes[0] = row[3] + row[0]; // левая
+        frustum.planes[1] = row[3] - row[0]; // правая
+        frustum.planes[2] = row[3] + row[1]; // нижняя
+        frustum.planes[3] = row[3] - row[1]; // верхняя
+        frustum.planes[4] = row[3] + row[2]; // ближняя
+        frustum.planes[5] = row[3] - row[2]; // дальняя
+        for (glm::vec4& plane : frustum.planes)
+            plane /= glm::length(glm::vec3(plane));
+        return frustum;
+    }
+
+    // Сфера хотя бы частично внутри пирамиды
+    bool intersectsSphere(const glm::vec3& center, float radius) const
+    {
+        for (const glm::vec4& plane : planes)
+            if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+                return false;
+        return true;
+    }
+
+    // Ограничивающий параллелепипед хотя бы частично внутри пирамиды (проверяется вершина, дальняя вдоль нормали)
+    bool intersectsBox(const glm::vec3& boxMin, const glm::vec3& boxMax) const
+    {
+        for (const glm::vec4& plane : planes)
+        {
+            glm::vec3 p(plane.x >= 0.0f ? boxMax.x : boxMin.x,
+                        plane.y >= 0.0f ? boxMax.y : boxMin.y,
+                        plane.z >= 0.0f ? boxMax.z : boxMin.z);
+            if (glm::dot(glm::vec3(plane), p) + plane.w < 0.0f)
+                return false;
+        }
+        return true;
+    }
+};
+#endif
@@ -0,0 +1,214 @@
+#ifndef GEOMETRY_POOL_H
+#define GEOMETRY_POOL_H
+
+#include <glad/glad.h>
+
+#include "vertex.h"
+#include "gpu_resources.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Общие вершинный и индексный буферы для многих мешей (одной модели или всех моделей сразу).
+// Меш получает диапазон в буферах, а рисуется через glDrawElementsBaseVertex из одного общего VAO,
+// поэтому между мешами не нужно переключать VAO, а соседние меши можно рисовать одним вызовом
+// glMultiDrawElementsBaseVertex. Индексы хранятся относительно начала меша (baseVertex).
+// В пуле формата VertexFormat::Packed вершины при загрузке сжимаются в PackedVertex.
+// Кости вершин (VertexBones) лежат в отдельном буфере с теми же номерами вершин. Он создается, когда в пул
+// попадает первый меш с костями; у остальных мешей в нем нулевые веса. Пулы без анимированных мешей его не имеют
+class GeometryPool
+{
+public:
+    // Положение меша в общих буферах
+    struct Range {
+        unsigned int firstIndex = 0;
+        unsigned int indexCount = 0;
+        int baseVertex = 0;
+        unsigned int vertexCount = 0;
+
+        // Смещение первого индекса для glDrawElements* (индексы типа GL_UNSIGNED_INT)
+        const void* indexOffset() const { return (const void*)((size_t)firstIndex * sizeof(unsigned int)); }
+    };
+
+    unsigned int VAO = 0;
+    const VertexFormat format;
+
+    // Начальная емкость в вершинах и индексах; при переполнении буферы увеличиваются вдвое.
+    // owner - имя пула в учете видеопамяти (gpu_resources.h)
+    explicit GeometryPool(size_t vertexCapacity = 1 << 16, size_t indexCapacity = 3 << 16, VertexFormat format = VertexFormat::Full,
+                          const std::string& owner = "geometry pool")
+        : format(format), owner(owner), vertexCapacity(vertexCapacity), indexCapacity(indexCapacity)
+    {
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glGenBuffers(1, &EBO);
+        gpuResources().add(GpuResources::VertexArray, VAO, owner);
+        gpuResources().addBuffer(VBO, GL_ARRAY_BUFFER, vertexCapacity * vertexStride(format), owner);
+        gpuResources().addBuffer(EBO, GL_ELEMENT_ARRAY_BUFFER, indexCapacity * sizeof(unsigned int), owner);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, vertexCapacity * vertexStride(format), NULL, GL_STATIC_DRAW);
+        // Индексный буфер заполняется через GL_COPY_WRITE_BUFFER, чтобы не изменить привязку EBO у текущего VAO
+        glBindBuffer(GL_COPY_WRITE_BUFFER, EBO);
+        glBufferData(GL_COPY_WRITE_BUFFER, indexCapacity * sizeof(unsigned int), NULL, GL_STATIC_DRAW);
+        bindVertexArray();
+    }
+
+    // Копирует вершины и индексы меша в конец общих буферов. quantization задает диапазон позиций
+    // для сжатого формата (в полном формате не используется), bones - кости вершин или nullptr
+    Range allocate(const Vertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount,
+                   const VertexQuantization& quantization = VertexQuantization(), const VertexBones* bones = nullptr)
+    {
+        if (bones && !boneVBO && format == VertexFormat::Full)
+            createBoneBuffer();
+        reserve(vertexCount, indexCount);
+
+        Range range;
+        range.firstIndex = (unsigned int)indexUsed;
+        range.indexCount = (unsigned int)indexCount;
+        range.baseVertex = (int)vertexUsed;
+        range.vertexCount = (unsigned int)vertexCount;
+
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        if (format == VertexFormat::Packed)
+        {
+            std::vector<PackedVertex> packed(vertexCount);
+            for (size_t i = 0; i < vertexCount; i++)
+                packed[i] = packVertex(vertices[i], quantization);
+            glBufferSubData(GL_ARRAY_BUFFER, vertexUsed * sizeof(PackedVertex), vertexCount * sizeof(PackedVertex), packed.data());
+        }
+        else
+            glBufferSubData(GL_ARRAY_BUFFER, vertexUsed * sizeof(Vertex), vertexCount * sizeof(Vertex), vertices);
+        if (boneVBO)
+        {
+            std::vector<VertexBones> none(bones ? 0 : vertexCount, VertexBones());
+            glBindBuffer(GL_ARRAY_BUFFER, boneVBO);
+            glBufferSubData(GL_ARRAY_BUFFER, vertexUsed * sizeof(VertexBones), vertexCount * sizeof(VertexBones), bones ? bones : none.data());
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, EBO);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, indexUsed * sizeof(unsigned int), indexCount * sizeof(unsigned int), indices);
+        vertexUsed += vertexCount;
+        indexUsed += indexCount;
+        return range;
+    }
+
+    // Дополнительные индексы для уже размещенных вершин (например, уровень детализации меша)
+    Range allocateIndices(const unsigned int* indices, size_t indexCount, const Range& vertices)
+    {
+        reserve(0, indexCount);
+
+        Range range = vertices;
+        range.firstIndex = (unsigned int)indexUsed;
+        range.indexCount = (unsigned int)indexCount;
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, EBO);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, indexUsed * sizeof(unsigned int), indexCount * sizeof(unsigned int), indices);
+        indexUsed += indexCount;
+        return range;
+    }
+
+    size_t vertexCount() const { return vertexUsed; }
+    size_t indexCount() const { return indexUsed; }
+
+    // Есть ли у пула буфер костей
+    bool hasBones() const { return boneVBO != 0; }
+
+    // Объем занятой части буферов, в байтах (кости - отдельно)
+    size_t vertexBytes() const { return vertexUsed * vertexStride(format); }
+    size_t boneBytes() const { return boneVBO ? vertexUsed * sizeof(VertexBones) : 0; }
+    size_t indexBytes() const { return indexUsed * sizeof(unsigned int); }
+
+    // Объем буферов в видеопамяти, в байтах
+    size_t memoryUsage() const
+    {
+        return vertexCapacity * (vertexStride(format) + (boneVBO ? sizeof(VertexBones) : 0)) + indexCapacity * sizeof(unsigned int);
+    }
+
+    void release()
+    {
+        gpuResources().remove(GpuResources::VertexArray, VAO);
+        gpuResources().remove(GpuResources::Buffer, VBO);
+        gpuResources().remove(GpuResources::Buffer, EBO);
+        gpuResources().remove(GpuResources::Buffer, boneVBO);
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteBuffers(1, &EBO);
+        if (boneVBO)
+            glDeleteBuffers(1, &boneVBO);
+        VAO = VBO = EBO = boneVBO = 0;
+    }
+
+private:
+    std::string owner;
+    unsigned int VBO = 0, EBO = 0, boneVBO = 0;
+    size_t vertexCapacity, indexCapacity;
+    size_t vertexUsed = 0, indexUsed = 0;
+
+    // Увеличение буферов, если в них не помещаются еще vertexCount вершин и indexCount индексов
+    void reserve(size_t vertexCount, size_t indexCount)
+    {
+        if (vertexUsed + vertexCount <= vertexCapacity && indexUsed + indexCount <= indexCapacity)
+            return;
+        size_t newVertexCapacity = std::max(vertexCapacity, vertexUsed + vertexCount);
+        size_t newIndexCapacity = std::max(indexCapacity, indexUsed + indexCount);
+        if (newVertexCapacity > vertexCapacity)
+            newVertexCapacity = std::max(newVertexCapacity, vertexCapacity * 2);
+        if (newIndexCapacity > indexCapacity)
+            newIndexCapacity = std::max(newIndexCapacity, indexCapacity * 2);
+        if (newVertexCapacity != vertexCapacity)
+            grow(VBO, GL_ARRAY_BUFFER, vertexUsed * vertexStride(format), newVertexCapacity * vertexStride(format), owner);
+        if (newVertexCapacity != vertexCapacity && boneVBO)
+            grow(boneVBO, GL_ARRAY_BUFFER, vertexUsed * sizeof(VertexBones), newVertexCapacity * sizeof(VertexBones), owner + " bones");
+        if (newIndexCapacity != indexCapacity)
+            grow(EBO, GL_ELEMENT_ARRAY_BUFFER, indexUsed * sizeof(unsigned int), newIndexCapacity * sizeof(unsigned int), owner);
+        vertexCapacity = newVertexCapacity;
+        indexCapacity = newIndexCapacity;
+        bindVertexArray();
+    }
+
+    // Привязка буферов к VAO (заново после каждого увеличения буферов)
+    void bindVertexArray()
+    {
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        if (format == VertexFormat::Packed)
+            setPackedVertexAttributes();
+        else
+            setVertexAttributes();
+        if (boneVBO)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, boneVBO);
+            setBoneAttributes();
+        }
+        glBindVertexArray(0);
+    }
+
+    // Буфер костей на всю емкость пула; вершины, уже лежащие в пуле, получают нулевые веса
+    void createBoneBuffer()
+    {
+        std::vector<VertexBones> none(vertexCapacity, VertexBones());
+        glGenBuffers(1, &boneVBO);
+        glBindBuffer(GL_ARRAY_BUFFER, boneVBO);
+        glBufferData(GL_ARRAY_BUFFER, vertexCapacity * sizeof(VertexBones), none.data(), GL_STATIC_DRAW);
+        gpuResources().addBuffer(boneVBO, GL_ARRAY_BUFFER, vertexCapacity * sizeof(VertexBones), owner + " bones");
+        bindVertexArray();
+    }
+
+    // Новый буфер большего размера; уже занятая часть копируется на стороне GPU
+    void grow(unsigned int& buffer, GLenum target, size_t usedBytes, size_t newBytes, const std::string& name)
+    {
+        unsigned int larger;
+        glGenBuffers(1, &larger);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, larger);
+        glBufferData(GL_COPY_WRITE_BUFFER, newBytes, NULL, GL_STATIC_DRAW);
+        glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, usedBytes);
+        glDeleteBuffers(1, &buffer);
+        gpuResources().remove(GpuResources::Buffer, buffer);
+        gpuResources().addBuffer(larger, target, newBytes, name);
+        buffer = larger;
+    }
+};
+#endif
@@ -0,0 +1,281 @@
+#ifndef GPU_PROFILER_H
+#define GPU_PROFILER_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "overlay.h"
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+
+// Профилировщик времени GPU по проходам рендеринга на основе glQueryCounter(GL_TIMESTAMP).
+// Запросы кадра N читаются только через FRAMES_IN_FLIGHT кадров, поэтому CPU никогда не ждет GPU
+class GpuProfiler
+{
+public:
+    static const int FRAMES_IN_FLIGHT = 3;
+    static const int MAX_SCOPES = 32;  // максимум замеров за кадр
+    static const int HISTORY = 120;    // длина скользящего окна для оверлея, в кадрах
+    static const int TRACE_FRAMES = 600; // сколько кадров хранится для выгрузки в CSV/JSON
+
+    // RAII-замер прохода: начинается в конструкторе и заканчивается в деструкторе
+    class Scope
+    {
+    public:
+        Scope(GpuProfiler& profiler, int pass) : profiler(profiler), record(profiler.beginScope(pass)) {}
+        ~Scope() { profiler.endScope(record); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        GpuProfiler& profiler;
+        int record;
+    };
+
+    GpuProfiler()
+    {
+        for (int i = 0; i < FRAMES_IN_FLIGHT; i++)
+        {
+            frames[i].queries.resize(MAX_SCOPES * 2);
+            glGenQueries(MAX_SCOPES * 2, frames[i].queries.data());
+        }
+    }
+
+    // Освобождение запросов (вызывается до уничтожения контекста)
+    void release()
+    {
+        for (int i = 0; i < FRAMES_IN_FLIGHT; i++)
+            glDeleteQueries(MAX_SCOPES * 2, frames[i].queries.data());
+    }
+
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    // Регистрация прохода; возвращаемый индекс используется в Scope, чтобы не искать строки каждый кадр
+    int addPass(const std::string& name)
+    {
+        Pass pass;
+        pass.name = name;
+        pass.history.assign(HISTORY, 0.0f);
+        passes.push_back(pass);
+        return (int)passes.size() - 1;
+    }
+
+    void beginFrame()
+    {
+        Frame& frame = frames[frameIndex % FRAMES_IN_FLIGHT];
+        frame.records.clear();
+        frame.number = frameIndex;
+    }
+
+    // Завершение кадра: забираем результаты самого старого кадра в пуле, если они уже готовы
+    void endFrame()
+    {
+        frameIndex++;
+        if (frameIndex < FRAMES_IN_FLIGHT)
+            return;
+
+        resolve(frames[frameIndex % FRAMES_IN_FLIGHT], false);
+    }
+
+    // Ожидание и чтение всех кадров, еще не прочитанных endFrame (от старых к новым). После вызова latest()
+    // относится к последнему завершенному кадру. Блокирует CPU, поэтому нужен там, где GPU все равно
+    // дожидаются (бенчмарк после glFinish, смена сцены), а не в обычном цикле рендеринга
+    void drain()
+    {
+        for (long long number = frameIndex - FRAMES_IN_FLIGHT + 1; number < frameIndex; number++)
+        {
+            if (number < 0)
+                continue;
+            Frame& frame = frames[number % FRAMES_IN_FLIGHT];
+            if (frame.number == number)
+                resolve(frame, true);
+        }
+    }
+
+    // Среднее время прохода за скользящее окно, в миллисекундах
+    float average(int pass) const
+    {
+        float sum = 0.0f;
+        for (float ms : passes[pass].history)
+            sum += ms;
+        return sum / HISTORY;
+    }
+
+    // Время прохода в последнем кадре, результаты которого уже получены (с задержкой в FRAMES_IN_FLIGHT кадров,
+    // после drain() - в последнем завершенном)
+    float latest(int pass) const
+    {
+        return passes[pass].history[(historyCursor + HISTORY - 1) % HISTORY];
+    }
+
+    // Краткая строка вида "terrain 1.20 | lights 0.05" (например, для заголовка окна)
+    std::string summary() const
+    {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2) << "GPU ms:";
+        for (size_t p = 0; p < passes.size(); p++)
+            out << (p ? " | " : " ") << passes[p].name << " " << average((int)p);
+        return out.str();
+    }
+
+    // Полоса в верхней части экрана: сегмент на каждый проход, вся ширина соответствует бюджету кадра budgetMs
+    void drawOverlay(Overlay& overlay, float budgetMs = 16.6f)
+    {
+        static const glm::vec4 colors[] = {
+            glm::vec4(0.90f, 0.30f, 0.20f, 0.8f),
+            glm::vec4(0.20f, 0.70f, 0.30f, 0.8f),
+            glm::vec4(0.20f, 0.40f, 0.90f, 0.8f),
+            glm::vec4(0.90f, 0.80f, 0.20f, 0.8f),
+            glm::vec4(0.70f, 0.30f, 0.80f, 0.8f),
+            glm::vec4(0.20f, 0.80f, 0.80f, 0.8f),
+        };
+        const float left = -0.95f, top = 0.95f, width = 1.9f, height = 0.04f;
+
+        overlay.begin();
+        overlay.rect(left, top - height, width, height, glm::vec4(0.0f, 0.0f, 0.0f, 0.4f));
+        float x = left;
+        for (size_t p = 0; p < passes.size(); p++)
+        {
+            float w = width * average((int)p) / budgetMs;
+            if (x + w > left + width)
+                w = left + width - x;
+            overlay.rect(x, top - height, w, height, colors[p % (sizeof(colors) / sizeof(colors[0]))]);
+            x += w;
+        }
+        overlay.end();
+    }
+
+    // Выгрузка сохраненных замеров в CSV: frame,pass,start_ms,duration_ms
+    bool dumpCsv(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            std::cout << "ERROR::GPU_PROFILER::CANNOT_WRITE " << path << std::endl;
+            return false;
+        }
+        file << "frame,pass,start_ms,duration_ms\n";
+        for (const TraceEvent& e : trace)
+            file << e.frame << ',' << passes[e.pass].name << ',' << e.start / 1.0e6 << ',' << (e.end - e.start) / 1.0e6 << '\n';
+        return true;
+    }
+
+    // Выгрузка в формате Chrome trace (chrome://tracing, Perfetto)
+    bool dumpChromeTrace(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            std::cout << "ERROR::GPU_PROFILER::CANNOT_WRITE " << path << std::endl;
+            return false;
+        }
+        file << "{\"traceEvents\":[\n";
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GPU\"}}";
+        file << std::fixed << std::setprecision(3);
+        for (const TraceEvent& e : trace)
+        {
+            file << ",\n{\"name\":\"" << passes[e.pass].name << "\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":0"
+                 << ",\"ts\":" << e.start / 1.0e3 << ",\"dur\":" << (e.end - e.start) / 1.0e3
+                 << ",\"args\":{\"frame\":" << e.frame << "}}";
+        }
+        file << "\n]}\n";
+        return true;
+    }
+
+private:
+    struct Record {
+        int pass;
+    };
+
+    struct Frame {
+        std::vector<GLuint> queries;  // пары (начало, конец) для каждого замера
+        std::vector<Record> records;
+        long long number = -1;
+    };
+
+    struct Pass {
+        std::string name;
+        std::vector<float> history;
+    };
+
+    struct TraceEvent {
+        long long frame;
+        int pass;
+        GLuint64 start, end; // наносекунды от первого замера
+    };
+
+    Frame frames[FRAMES_IN_FLIGHT];
+    std::vector<Pass> passes;
+    std::deque<TraceEvent> trace;
+    long long frameIndex = 0;
+    int historyCursor = 0;
+    GLuint64 timeOrigin = 0;
+
+    int beginScope(int pass)
+    {
+        Frame& frame = frames[frameIndex % FRAMES_IN_FLIGHT];
+        if (frame.records.size() >= (size_t)MAX_SCOPES)
+            return -1;
+        frame.records.push_back({ pass });
+        int record = (int)frame.records.size() - 1;
+        glQueryCounter(frame.queries[record * 2], GL_TIMESTAMP);
+        return record;
+    }
+
+    void endScope(int record)
+    {
+        if (record < 0)
+            return;
+        Frame& frame = frames[frameIndex % FRAMES_IN_FLIGHT];
+        glQueryCounter(frame.queries[record * 2 + 1], GL_TIMESTAMP);
+    }
+
+    // Чтение результатов кадра в историю проходов. Если wait = false и хотя бы один запрос еще не готов,
+    // результаты кадра пропускаются, но CPU не блокируется
+    void resolve(Frame& frame, bool wait)
+    {
+        if (frame.records.empty() || frame.number < 0)
+            return;
+
+        for (size_t i = 0; i < frame.records.size() * 2 && !wait; i++)
+        {
+            GLint available = 0;
+            glGetQueryObjectiv(frame.queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+            {
+                frame.number = -1;
+                return;
+            }
+        }
+
+        std::vector<float> frameMs(passes.size(), 0.0f);
+        for (size_t i = 0; i < frame.records.size(); i++)
+        {
+            Record& record = frame.records[i];
+            GLuint64 start = 0, end = 0;
+            glGetQueryObjectui64v(frame.queries[i * 2], GL_QUERY_RESULT, &start);
+            glGetQueryObjectui64v(frame.queries[i * 2 + 1], GL_QUERY_RESULT, &end);
+            if (timeOrigin == 0)
+                timeOrigin = start;
+
+            frameMs[record.pass] += (end - start) / 1.0e6f;
+            trace.push_back({ frame.number, record.pass, start - timeOrigin, end - timeOrigin });
+        }
+        while (trace.size() > (size_t)TRACE_FRAMES * MAX_SCOPES || (!trace.empty() && trace.front().frame + TRACE_FRAMES < frame.number))
+            trace.pop_front();
+
+        for (size_t p = 0; p < passes.size(); p++)
+        {
+            passes[p].history[historyCursor] = frameMs[p];
+        }
+        historyCursor = (historyCursor + 1) % HISTORY;
+        frame.number = -1;
+    }
+};
+#endif
@@ -0,0 +1,284 @@
+#ifndef GPU_RESOURCES_H
+#define GPU_RESOURCES_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "overlay.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Учет объектов OpenGL, занимающих видеопамять: текстур, буферов и VAO. Код, создающий объект,
+// регистрирует его сразу после glGen* (с владельцем - путем файла или названием подсистемы), сообщает размер
+// и формат после выделения памяти и удаляет запись вместе с glDelete*. По записям строятся итоги
+// по категориям (оверлей, заголовок окна), полный список (dump) и отчет об утечках при завершении.
+// Размер - оценка по размерам и формату: фактическое выравнивание и служебные данные драйвера не видны
+class GpuResources
+{
+public:
+    enum Category {
+        Texture,
+        Buffer,
+        VertexArray,
+        CATEGORY_COUNT
+    };
+
+    struct Resource {
+        unsigned int id = 0;
+        std::string owner;
+        GLenum format = 0;         // внутренний формат текстуры или цель буфера
+        int width = 0, height = 0; // только для текстур
+        int levels = 0;            // загруженные мип-уровни
+        size_t bytes = 0;
+    };
+
+    struct Totals {
+        size_t count = 0;
+        size_t bytes = 0;
+    };
+
+    // Новый объект без выделенной памяти
+    void add(Category category, unsigned int id, const std::string& owner)
+    {
+        Resource& resource = resources[category][id];
+        resource = Resource();
+        resource.id = id;
+        resource.owner = owner;
+    }
+
+    // Буфер с данными bytes байт для цели target (GL_ARRAY_BUFFER, GL_PIXEL_UNPACK_BUFFER, ...)
+    void addBuffer(unsigned int id, GLenum target, size_t bytes, const std::string& owner)
+    {
+        add(Buffer, id, owner);
+        resize(Buffer, id, bytes);
+        resources[Buffer][id].format = target;
+    }
+
+    // Размер и формат текстуры после загрузки уровней
+    void setTexture(unsigned int id, int width, int height, GLenum internalFormat, int levels, size_t bytes)
+    {
+        auto found = resources[Texture].find(id);
+        if (found == resources[Texture].end())
+            return;
+        Resource& resource = found->second;
+        totals[Texture].bytes -= resource.bytes;
+        resource.width = width;
+        resource.height = height;
+        resource.format = internalFormat;
+        resource.levels = levels;
+        resource.bytes = bytes;
+        totals[Texture].bytes += bytes;
+    }
+
+    // Новый объем объекта (пересоздание буфера, подгрузка или выгрузка мип-уровней)
+    void resize(Category category, unsigned int id, size_t bytes, int levels = -1)
+    {
+        auto found = resources[category].find(id);
+        if (found == resources[category].end())
+            return;
+        totals[category].bytes -= found->second.bytes;
+        found->second.bytes = bytes;
+        if (levels >= 0)
+            found->second.levels = levels;
+        totals[category].bytes += bytes;
+    }
+
+    // Удаление записи (вместе с glDelete*); неизвестные идентификаторы и 0 пропускаются
+    void remove(Category category, unsigned int id)
+    {
+        auto found = resources[category].find(id);
+        if (found == resources[category].end())
+            return;
+        totals[category].bytes -= found->second.bytes;
+        resources[category].erase(found);
+    }
+
+    Totals total(Category category) const
+    {
+        Totals result = totals[category];
+        result.count = resources[category].size();
+        return result;
+    }
+
+    size_t memoryUsage() const
+    {
+        size_t bytes = 0;
+        for (int c = 0; c < CATEGORY_COUNT; c++)
+            bytes += totals[c].bytes;
+        return bytes;
+    }
+
+    // Итоги одной строкой для заголовка окна
+    std::string summary() const
+    {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(1) << "VRAM " << memoryUsage() / 1048576.0 << " MB:";
+        for (int c = 0; c < CATEGORY_COUNT; c++)
+            out << (c ? "," : "") << " " << total((Category)c).count << " " << categoryName((Category)c)
+                << (c == VertexArray ? "" : " " + megabytes(totals[c].bytes));
+        return out.str();
+    }
+
+    // Полоса под полосой профилировщика GPU: сегменты текстур и буферов, вся ширина - budgetBytes.
+    // Светлая засечка отмечает каждые 64 МБ
+    void drawOverlay(Overlay& overlay, size_t budgetBytes = (size_t)1 << 30)
+    {
+        static const glm::vec4 colors[] = {
+            glm::vec4(0.90f, 0.50f, 0.10f, 0.8f),
+            glm::vec4(0.30f, 0.60f, 0.90f, 0.8f),
+        };
+        const float left = -0.95f, top = 0.90f, width = 1.9f, height = 0.02f;
+
+        overlay.begin();
+        overlay.rect(left, top - height, width, height, glm::vec4(0.0f, 0.0f, 0.0f, 0.4f));
+        float x = left;
+        for (int c = Texture; c <= Buffer; c++)
+        {
+            float w = std::min(width * (float)totals[c].bytes / budgetBytes, left + width - x);
+            overlay.rect(x, top - height, w, height, colors[c]);
+            x += w;
+        }
+        for (size_t mark = (size_t)64 << 20; mark < budgetBytes; mark += (size_t)64 << 20)
+            overlay.rect(left + width * (float)mark / budgetBytes, top - height, 0.002f, height, glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
+        overlay.end();
+    }
+
+    // Итоги по категориям и все объекты (по убыванию размера) в поток out
+    void dump(std::ostream& out) const
+    {
+        out << summary() << "\n";
+        for (int c = 0; c < CATEGORY_COUNT; c++)
+            for (const Resource* resource : sorted((Category)c))
+                out << "  " << describe((Category)c, *resource) << "\n";
+        out.flush();
+    }
+
+    // Все объекты в CSV: category,id,owner,format,width,height,levels,bytes
+    bool dumpCsv(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            std::cout << "ERROR::GPU_RESOURCES::CANNOT_WRITE " << path << std::endl;
+            return false;
+        }
+        file << "category,id,owner,format,width,height,levels,bytes\n";
+        for (int c = 0; c < CATEGORY_COUNT; c++)
+            for (const Resource* resource : sorted((Category)c))
+                file << objectName((Category)c) << ',' << resource->id << ",\"" << resource->owner << "\"," << formatName(resource->format)
+                     << ',' << resource->width << ',' << resource->height << ',' << resource->levels << ',' << resource->bytes << '\n';
+        return true;
+    }
+
+    // Отчет об объектах, не удаленных до завершения (вызывается перед уничтожением контекста).
+    // Возвращает их число
+    size_t reportLeaks() const
+    {
+        size_t leaks = 0;
+        for (int c = 0; c < CATEGORY_COUNT; c++)
+            leaks += resources[c].size();
+        if (leaks == 0)
+            return 0;
+        std::cout << "ERROR::GPU_RESOURCES::LEAKED " << leaks << " objects, " << megabytes(memoryUsage()) << std::endl;
+        for (int c = 0; c < CATEGORY_COUNT; c++)
+            for (const Resource* resource : sorted((Category)c))
+                std::cout << "  " << describe((Category)c, *resource) << std::endl;
+        return leaks;
+    }
+
+    static const char* categoryName(Category category)
+    {
+        static const char* names[] = { "textures", "buffers", "VAOs" };
+        return names[category];
+    }
+
+private:
+    std::unordered_map<unsigned int, Resource> resources[CATEGORY_COUNT];
+    Totals totals[CATEGORY_COUNT]; // count не используется: число объектов - размер таблицы
+
+    std::vector<const Resource*> sorted(Category category) const
+    {
+        std::vector<const Resource*> result;
+        for (const auto& item : resources[category])
+            result.push_back(&item.second);
+        std::sort(result.begin(), result.end(), [](const Resource* a, const Resource* b) {
+            return a->bytes != b->bytes ? a->bytes > b->bytes : a->id < b->id;
+        });
+        return result;
+    }
+
+    static const char* objectName(Category category)
+    {
+        static const char* names[] = { "texture", "buffer", "VAO" };
+        return names[category];
+    }
+
+    static std::string megabytes(size_t bytes)
+    {
+        char text[32];
+        std::snprintf(text, sizeof(text), "%.2f MB", bytes / 1048576.0);
+        return text;
+    }
+
+    static std::string describe(Category category, const Resource& resource)
+    {
+        std::ostringstream out;
+        out << objectName(category) << " " << resource.id << " [" << resource.owner << "]";
+        if (category == Texture)
+            out << " " << resource.width << "x" << resource.height << " " << formatName(resource.format) << ", " << resource.levels << " levels";
+        else if (category == Buffer)
+            out << " " << formatName(resource.format);
+        if (category != VertexArray)
+            out << ", " << megabytes(resource.bytes);
+        return out.str();
+    }
+
+    static std::string formatName(GLenum format)
+    {
+        switch (format)
+        {
+        case 0: return "-";
+        case GL_R8: return "R8";
+        case GL_RG8: return "RG8";
+        case GL_RGB8: return "RGB8";
+        case GL_RGBA8: return "RGBA8";
+        case GL_SRGB8: return "SRGB8";
+        case GL_SRGB8_ALPHA8: return "SRGB8_ALPHA8";
+        case GL_RGBA32F: return "RGBA32F";
+        case GL_COMPRESSED_RED_RGTC1: return "BC4";
+        case GL_COMPRESSED_RG_RGTC2: return "BC5";
+        // S3TC из GL_EXT_texture_compression_s3tc / GL_EXT_texture_sRGB (нет в glad, см. texture_cache.h)
+        case 0x83F0: return "BC1";
+        case 0x83F3: return "BC3";
+        case 0x8C4C: return "BC1_SRGB";
+        case 0x8C4F: return "BC3_SRGB";
+        case GL_ARRAY_BUFFER: return "vertices";
+        case GL_ELEMENT_ARRAY_BUFFER: return "indices";
+        case GL_TEXTURE_BUFFER: return "texture buffer";
+        case GL_PIXEL_UNPACK_BUFFER: return "pixel unpack";
+        default:
+        {
+            char text[16];
+            std::snprintf(text, sizeof(text), "0x%04X", format);
+            return text;
+        }
+        }
+    }
+};
+
+// Учет объектов OpenGL процесса
+inline GpuResources& gpuResources()
+{
+    static GpuResources registry;
+    return registry;
+}
+#endif
@@ -0,0 +1,117 @@
+#ifndef HEIGHTMAP_H
+#define HEIGHTMAP_H
+
+#include "stb_image.h"
+#include "mapped_file.h"
+#include "thread_pool.h"
+#include "profiler.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Импорт карты высот из PNG (8 или 16 бит на канал) напрямую через stb_image: файл отображается в память
+// и декодируется сразу в один канал (stbi_load_from_memory / stbi_load_16_from_memory с desired_channels = 1),
+// так что полное RGBA-изображение не создается. У многоканальных изображений берется яркость.
+// Высоты хранятся 16-битными (8-битные значения растягиваются умножением на 257, чтобы 255 -> 65535)
+// и при загрузке разрезаются на квадратные фрагменты CHUNK_SIZE x CHUNK_SIZE: большие карты можно
+// обрабатывать и выгружать по частям, а декодированный буфер освобождается сразу после нарезки.
+// Первая строка изображения соответствует z = 0.
+// 16-битные файлы принимаются только ради совместимости с источниками (редакторы ландшафта обычно сохраняют 16 бит):
+// World::fromHeightmap строит столбцы из целого числа кубов с шагом World::HEIGHT_STEP, и дробные высоты
+// теряются. Полная точность доступна через sample() тому, кто строит по карте гладкую поверхность
+class Heightmap
+{
+public:
+    static const int CHUNK_SIZE = 64;
+
+    struct Chunk {
+        int x = 0, z = 0;          // левый верхний угол в отсчетах карты
+        int width = 0, depth = 0;  // меньше CHUNK_SIZE у правого и нижнего края
+        std::vector<uint16_t> samples; // по строкам z, width отсчетов в строке
+
+        uint16_t sample(int localX, int localZ) const { return samples[(size_t)localZ * width + localX]; }
+    };
+
+    int width = 0, depth = 0;
+    int bitDepth = 0;            // разрядность исходного файла: 8 или 16
+    int chunksX = 0, chunksZ = 0;
+    std::vector<Chunk> chunks;   // по строкам фрагментов
+
+    bool empty() const { return chunks.empty(); }
+
+    // Загрузка из файла path. false, если файл не прочитан (сообщение выводится в консоль)
+    bool load(const std::string& path)
+    {
+        PROFILE_SCOPE("load heightmap");
+        MappedFile file(path);
+        if (!file.isOpen())
+        {
+            std::cout << "ERROR::HEIGHTMAP::CANNOT_OPEN " << path << std::endl;
+            return false;
+        }
+        // Флаг переворота stb_image общий для потока: после загрузки текстур (TextureParams::flip) он может быть
+        // включен, и карта оказалась бы отраженной по z относительно исходной ориентации
+        stbi_set_flip_vertically_on_load_thread(false);
+        int components;
+        const stbi_uc* bytes = file.data();
+        int size = (int)file.size();
+        void* pixels;
+        if (stbi_is_16_bit_from_memory(bytes, size))
+        {
+            pixels = stbi_load_16_from_memory(bytes, size, &width, &depth, &components, 1);
+            bitDepth = 16;
+        }
+        else
+        {
+            pixels = stbi_load_from_memory(bytes, size, &width, &depth, &components, 1);
+            bitDepth = 8;
+        }
+        if (!pixels)
+        {
+            std::cout << "ERROR::HEIGHTMAP::CANNOT_DECODE " << path << ": " << stbi_failure_reason() << std::endl;
+            width = depth = 0;
+            return false;
+        }
+
+        chunksX = (width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        chunksZ = (depth + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        chunks.assign((size_t)chunksX * chunksZ, Chunk());
+        workerPool().parallelFor(chunks.size(), [&](size_t i) {
+            Chunk& chunk = chunks[i];
+            chunk.x = (int)(i % chunksX) * CHUNK_SIZE;
+            chunk.z = (int)(i / chunksX) * CHUNK_SIZE;
+            chunk.width = std::min((int)CHUNK_SIZE, width - chunk.x);
+            chunk.depth = std::min((int)CHUNK_SIZE, depth - chunk.z);
+            chunk.samples.resize((size_t)chunk.width * chunk.depth);
+            for (int z = 0; z < chunk.depth; z++)
+            {
+                size_t row = (size_t)(chunk.z + z) * width + chunk.x;
+                uint16_t* out = &chunk.samples[(size_t)z * chunk.width];
+                if (bitDepth == 16)
+                    std::memcpy(out, (const uint16_t*)pixels + row, chunk.width * sizeof(uint16_t));
+                else
+                    for (int x = 0; x < chunk.width; x++)
+                        out[x] = (uint16_t)(((const stbi_uc*)pixels)[row + x] * 257);
+            }
+        });
+        stbi_image_free(pixels);
+        return true;
+    }
+
+    const Chunk& chunkAt(int x, int z) const
+    {
+        return chunks[(size_t)(z / CHUNK_SIZE) * chunksX + x / CHUNK_SIZE];
+    }
+
+    // 16-битная высота в точке (x, z)
+    uint16_t sample(int x, int z) const
+    {
+        const Chunk& chunk = chunkAt(x, z);
+        return chunk.sample(x - chunk.x, z - chunk.z);
+    }
+};
+#endif
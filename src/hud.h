@@ -0,0 +1,130 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "shader.h"
+#include "texture_atlas.h"
+#include "sampler_cache.h"
+#include "gpu_resources.h"
+#include "render_stats.h"
+
+#include <cstddef>
+#include <vector>
+
+// Элементы интерфейса поверх кадра: спрайты из атласа (texture_atlas.h) в нормализованных координатах
+// устройства. За кадр спрайты накапливаются в вершинном массиве и рисуются в draw() одним вызовом
+// на страницу атласа (обычно одним на весь интерфейс), а не привязкой текстуры и вызовом на каждый значок
+class Hud
+{
+public:
+    explicit Hud(const TextureAtlas& atlas) : atlas(atlas), shader("../src/shaders/hud.vs", "../src/shaders/hud.fs")
+    {
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        gpuResources().add(GpuResources::VertexArray, VAO, "hud");
+        gpuResources().addBuffer(VBO, GL_ARRAY_BUFFER, 0, "hud");
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, uv));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+        glEnableVertexAttribArray(2);
+        glBindVertexArray(0);
+
+        shader.use();
+        shader.setInt("atlas", 0);
+    }
+
+    Hud(const Hud&) = delete;
+    Hud& operator=(const Hud&) = delete;
+
+    // Спрайт region с центром center и размерами size в NDC; цвет изображения умножается на color
+    void sprite(const TextureAtlas::Region& region, const glm::vec2& center, const glm::vec2& size, const glm::vec4& color = glm::vec4(1.0f))
+    {
+        if (!region.valid())
+            return;
+        if (batches.size() <= (size_t)region.page)
+            batches.resize(region.page + 1);
+        glm::vec2 low = center - size * 0.5f, high = center + size * 0.5f;
+        Vertex corners[4] = {
+            { low, glm::vec2(region.uv.x, region.uv.y), color },
+            { glm::vec2(high.x, low.y), glm::vec2(region.uv.z, region.uv.y), color },
+            { glm::vec2(low.x, high.y), glm::vec2(region.uv.x, region.uv.w), color },
+            { high, glm::vec2(region.uv.z, region.uv.w), color },
+        };
+        std::vector<Vertex>& batch = batches[region.page];
+        for (int i : { 0, 1, 2, 2, 1, 3 })
+            batch.push_back(corners[i]);
+    }
+
+    // Отрисовка накопленных спрайтов (без теста глубины, с альфа-смешиванием) и очистка списка
+    void draw()
+    {
+        vertices.clear();
+        for (const std::vector<Vertex>& batch : batches)
+            vertices.insert(vertices.end(), batch.begin(), batch.end());
+        if (vertices.empty())
+            return;
+
+        // Буфер пересоздается каждый кадр (orphaning), как и буфер экземпляров
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        if (vertices.size() > capacity)
+        {
+            capacity = vertices.size() + vertices.size() / 2;
+            gpuResources().resize(GpuResources::Buffer, VBO, capacity * sizeof(Vertex));
+        }
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(Vertex), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(Vertex), vertices.data());
+
+        glDisable(GL_DEPTH_TEST);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        shader.use();
+        glBindVertexArray(VAO);
+        glActiveTexture(GL_TEXTURE0);
+        samplerCache().bind(0, GL_CLAMP_TO_EDGE);
+        GLint first = 0;
+        for (size_t page = 0; page < batches.size(); page++)
+        {
+            if (batches[page].empty())
+                continue;
+            glBindTexture(GL_TEXTURE_2D, atlas.pageTexture((int)page));
+            glDrawArrays(GL_TRIANGLES, first, (GLsizei)batches[page].size());
+            renderStats().draw(batches[page].size() / 3);
+            first += (GLint)batches[page].size();
+            batches[page].clear();
+        }
+        glBindVertexArray(0);
+        glDisable(GL_BLEND);
+        glEnable(GL_DEPTH_TEST);
+    }
+
+    // Освобождение ресурсов OpenGL (вызывается до уничтожения контекста)
+    void release()
+    {
+        gpuResources().remove(GpuResources::VertexArray, VAO);
+        gpuResources().remove(GpuResources::Buffer, VBO);
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteProgram(shader.ID);
+    }
+
+private:
+    struct Vertex {
+        glm::vec2 position;
+        glm::vec2 uv;
+        glm::vec4 color;
+    };
+
+    const TextureAtlas& atlas;
+    Shader shader;
+    unsigned int VAO = 0, VBO = 0;
+    size_t capacity = 0;
+    std::vector<std::vector<Vertex>> batches; // спрайты кадра по страницам атласа (память переиспользуется)
+    std::vector<Vertex> vertices;
+};
+#endif
@@ -0,0 +1,104 @@
+#ifndef IMAGE_LOADER_H
+#define IMAGE_LOADER_H
+
+#include "stb_image.h"
+#include "mapped_file.h"
+#include "thread_pool.h"
+#include "profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Декодирование изображений без блокирующего чтения через stdio: файл отображается в память
+// и декодируется stbi_load_from_memory. Переворот по вертикали задается для каждого вызова
+// (stbi_set_flip_vertically_on_load_thread хранит флаг в thread_local), поэтому изображения
+// можно декодировать параллельно в пуле потоков
+namespace ImageLoader
+{
+    struct Image {
+        std::string path;
+        bool flip = true;
+        int width = 0, height = 0, components = 0;
+        unsigned char* pixels = nullptr; // nullptr, если файл не прочитан или не декодирован
+        size_t fileBytes = 0;
+
+        size_t pixelBytes() const { return (size_t)width * height * components; }
+
+        // Освобождение пикселей после загрузки в OpenGL
+        void release()
+        {
+            stbi_image_free(pixels);
+            pixels = nullptr;
+        }
+    };
+
+    // Статистика пакета: объем файлов и декодированных пикселей, время декодирования
+    struct BatchStatistics {
+        size_t images = 0, failed = 0;
+        size_t fileBytes = 0, pixelBytes = 0;
+        double seconds = 0.0;
+
+        double fileThroughput() const { return seconds > 0.0 ? fileBytes / seconds / (1 << 20) : 0.0; }
+        double pixelThroughput() const { return seconds > 0.0 ? pixelBytes / seconds / (1 << 20) : 0.0; }
+    };
+
+    // Декодирование image.path с исходным числом каналов. false, если файл не открылся или не декодировался
+    inline bool decode(Image& image)
+    {
+        PROFILE_SCOPE("decode image");
+        MappedFile file(image.path);
+        if (!file.isOpen())
+            return false;
+        image.fileBytes = file.size();
+        stbi_set_flip_vertically_on_load_thread(image.flip);
+        image.pixels = stbi_load_from_memory(file.data(), (int)file.size(), &image.width, &image.height, &image.components, 0);
+        return image.pixels != nullptr;
+    }
+
+    // Параллельное декодирование пакета: не больше maxConcurrent изображений одновременно
+    // (0 - по числу потоков пула). Каждая из дорожек берет следующее изображение из общего счетчика,
+    // так что крупные файлы не задерживают остальные
+    inline BatchStatistics decodeBatch(std::vector<Image>& images, size_t maxConcurrent = 0)
+    {
+        PROFILE_SCOPE("decode images");
+        BatchStatistics statistics;
+        statistics.images = images.size();
+        if (images.empty())
+            return statistics;
+        if (maxConcurrent == 0)
+            maxConcurrent = workerPool().size() + 1; // рабочие потоки и вызывающий
+        size_t lanes = std::min(maxConcurrent, images.size());
+
+        auto start = std::chrono::steady_clock::now();
+        std::atomic<size_t> next{ 0 };
+        workerPool().parallelFor(lanes, [&](size_t) {
+            for (size_t i; (i = next.fetch_add(1)) < images.size(); )
+                decode(images[i]);
+        });
+        statistics.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (const Image& image : images)
+        {
+            statistics.fileBytes += image.fileBytes;
+            if (image.pixels)
+                statistics.pixelBytes += image.pixelBytes();
+            else
+                statistics.failed++;
+        }
+        return statistics;
+    }
+
+    inline void report(const BatchStatistics& statistics)
+    {
+        std::cout << "Decoded " << statistics.images - statistics.failed << "/" << statistics.images << " images: "
+                  << statistics.fileBytes / 1024 << " KB files, " << statistics.pixelBytes / 1024 << " KB pixels in "
+                  << statistics.seconds * 1000.0 << " ms (" << statistics.fileThroughput() << " MB/s read, "
+                  << statistics.pixelThroughput() << " MB/s decoded)" << std::endl;
+    }
+}
+#endif
@@ -0,0 +1,87 @@
+#ifndef INSTANCING_H
+#define INSTANCING_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "gpu_resources.h"
+
+#include <cstddef>
+
+// Компактное описание экземпляра (32 байта вместо 64 у матрицы): позиция, равномерный масштаб и поворот
+struct Instance {
+    glm::vec3 position;
+    float scale = 1.0f;
+    glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+
+    glm::mat4 matrix() const
+    {
+        glm::mat4 m = glm::mat4_cast(rotation) * scale;
+        m[3] = glm::vec4(position, 1.0f);
+        return m;
+    }
+};
+
+// Буфер матриц экземпляров для glDraw*Instanced. Матрица передается в атрибуты ATTRIBUTE..ATTRIBUTE+3
+// (по столбцу в каждом) с делителем 1, см. shaders/model_instanced.vs
+class InstanceBuffer
+{
+public:
+    static const unsigned int ATTRIBUTE = 5; // 0-4 заняты атрибутами Vertex
+
+    explicit InstanceBuffer(size_t capacity = 1024) : capacity(capacity)
+    {
+        glGenBuffers(1, &VBO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(glm::mat4), NULL, GL_STREAM_DRAW);
+        gpuResources().addBuffer(VBO, GL_ARRAY_BUFFER, capacity * sizeof(glm::mat4), "instance buffer");
+    }
+
+    // Загрузка матриц кадра. Буфер каждый раз пересоздается (orphaning), чтобы не ждать GPU,
+    // который еще может читать данные прошлого кадра
+    void upload(const glm::mat4* transforms, size_t count)
+    {
+        if (count > capacity)
+        {
+            capacity = count + count / 2;
+            gpuResources().resize(GpuResources::Buffer, VBO, capacity * sizeof(glm::mat4));
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(glm::mat4), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(glm::mat4), transforms);
+    }
+
+    // Подключение буфера к текущему привязанному VAO, начиная с матрицы first (в OpenGL 3.3 нет
+    // baseInstance, поэтому смещение задается в указателе атрибута). VAO может быть общим для нескольких
+    // моделей (GeometryPool), поэтому атрибуты настраиваются заново перед каждой отрисовкой
+    void bind(size_t first = 0) const
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        for (unsigned int i = 0; i < 4; i++)
+        {
+            glEnableVertexAttribArray(ATTRIBUTE + i);
+            glVertexAttribPointer(ATTRIBUTE + i, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(first * sizeof(glm::mat4) + i * sizeof(glm::vec4)));
+            glVertexAttribDivisor(ATTRIBUTE + i, 1);
+        }
+    }
+
+    // Отключение атрибутов экземпляра от текущего VAO, чтобы обычная отрисовка не читала буфер
+    static void unbind()
+    {
+        for (unsigned int i = 0; i < 4; i++)
+            glDisableVertexAttribArray(ATTRIBUTE + i);
+    }
+
+    void release()
+    {
+        gpuResources().remove(GpuResources::Buffer, VBO);
+        glDeleteBuffers(1, &VBO);
+        VBO = 0;
+    }
+
+private:
+    unsigned int VBO = 0;
+    size_t capacity;
+};
+#endif
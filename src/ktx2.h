@@ -0,0 +1,273 @@
+#ifndef KTX2_H
+#define KTX2_H
+
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Минимальная поддержка контейнера KTX2 (Khronos Texture 2.0) для двумерных текстур с мип-уровнями
+// без суперсжатия. Пишется и читается только то, что нужно запеченным текстурам: формат Vulkan,
+// размеры, уровни, дескриптор формата (DFD) и пары ключ-значение
+namespace Ktx2
+{
+    const unsigned char IDENTIFIER[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    // Значения VkFormat для блочных форматов
+    enum VkFormat : uint32_t {
+        BC1_RGB_UNORM = 131,
+        BC1_RGB_SRGB = 132,
+        BC3_UNORM = 137,
+        BC3_SRGB = 138,
+        BC4_UNORM = 139,
+        BC5_UNORM = 141,
+    };
+
+    struct Header {
+        unsigned char identifier[12];
+        uint32_t vkFormat;
+        uint32_t typeSize;
+        uint32_t pixelWidth, pixelHeight, pixelDepth;
+        uint32_t layerCount, faceCount, levelCount;
+        uint32_t supercompressionScheme;
+        uint32_t dfdByteOffset, dfdByteLength;
+        uint32_t kvdByteOffset, kvdByteLength;
+        uint64_t sgdByteOffset, sgdByteLength;
+    };
+
+    struct LevelIndex {
+        uint64_t byteOffset, byteLength, uncompressedByteLength;
+    };
+
+    // Текстура: levels[0] - самый крупный уровень. При чтении data указывает в отображенный файл
+    struct Image {
+        uint32_t vkFormat = 0;
+        uint32_t width = 0, height = 0;
+        struct Level {
+            const unsigned char* data;
+            size_t size;
+        };
+        std::vector<Level> levels;
+        std::map<std::string, std::string> keyValues;
+    };
+
+    inline bool isBlockFormat(uint32_t vkFormat)
+    {
+        switch (vkFormat)
+        {
+        case BC1_RGB_UNORM: case BC1_RGB_SRGB: case BC3_UNORM: case BC3_SRGB: case BC4_UNORM: case BC5_UNORM:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    inline uint32_t blockBytes(uint32_t vkFormat)
+    {
+        return vkFormat == BC1_RGB_UNORM || vkFormat == BC1_RGB_SRGB || vkFormat == BC4_UNORM ? 8 : 16;
+    }
+
+    // Размер мип-уровня level текстуры width x height: блоки 4x4, неполные блоки на краях дополняются
+    inline uint64_t levelBytes(uint32_t vkFormat, uint32_t width, uint32_t height, uint32_t level)
+    {
+        uint64_t levelWidth = std::max<uint64_t>(1, width >> level), levelHeight = std::max<uint64_t>(1, height >> level);
+        return (levelWidth + 3) / 4 * ((levelHeight + 3) / 4) * blockBytes(vkFormat);
+    }
+
+    // Базовый дескриптор формата Khronos Data Format для блочного формата
+    inline std::vector<uint32_t> dataFormatDescriptor(uint32_t vkFormat)
+    {
+        uint32_t colorModel, samples[2][2]; // [канал, смещение в битах]
+        uint32_t sampleCount = 1;
+        bool srgb = vkFormat == BC1_RGB_SRGB || vkFormat == BC3_SRGB;
+        switch (vkFormat)
+        {
+        case BC1_RGB_UNORM: case BC1_RGB_SRGB:
+            colorModel = 128; samples[0][0] = 0; samples[0][1] = 0; // KHR_DF_MODEL_BC1A, канал цвета
+            break;
+        case BC3_UNORM: case BC3_SRGB:
+            colorModel = 130; sampleCount = 2;                       // KHR_DF_MODEL_BC3
+            samples[0][0] = 15; samples[0][1] = 0;                   // альфа
+            samples[1][0] = 0; samples[1][1] = 64;                   // цвет
+            break;
+        case BC4_UNORM:
+            colorModel = 131; samples[0][0] = 0; samples[0][1] = 0;  // KHR_DF_MODEL_BC4
+            break;
+        default:
+            colorModel = 132; sampleCount = 2;                       // KHR_DF_MODEL_BC5
+            samples[0][0] = 0; samples[0][1] = 0;                    // красный
+            samples[1][0] = 1; samples[1][1] = 64;                   // зеленый
+            break;
+        }
+        uint32_t blockSize = 24 + 16 * sampleCount;
+        std::vector<uint32_t> dfd;
+        dfd.push_back(4 + blockSize);                                       // общий размер
+        dfd.push_back(0);                                                   // vendorId = KHRONOS, descriptorType = BASICFORMAT
+        dfd.push_back(2 | blockSize << 16);                                 // versionNumber = 2, descriptorBlockSize
+        dfd.push_back(colorModel | 1 << 8 | (srgb ? 2u : 1u) << 16);        // модель, BT709, передаточная функция
+        dfd.push_back(3 | 3 << 8);                                          // блок 4x4x1x1
+        dfd.push_back(blockBytes(vkFormat));                                // bytesPlane0
+        dfd.push_back(0);
+        for (uint32_t s = 0; s < sampleCount; s++)
+        {
+            dfd.push_back(samples[s][1] | 63u << 16 | samples[s][0] << 24);     // bitOffset, bitLength - 1, channelType
+            dfd.push_back(0);                                               // samplePosition
+            dfd.push_back(0);                                               // sampleLower
+            dfd.push_back(0xFFFFFFFFu);                                     // sampleUpper
+        }
+        return dfd;
+    }
+
+    inline uint64_t align(uint64_t offset, uint64_t alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    // Запись текстуры; data уровней указывает на сжатые данные в памяти
+    inline bool write(const std::string& path, const Image& image)
+    {
+        Header header = {};
+        std::memcpy(header.identifier, IDENTIFIER, sizeof(IDENTIFIER));
+        header.vkFormat = image.vkFormat;
+        header.typeSize = 1;
+        header.pixelWidth = image.width;
+        header.pixelHeight = image.height;
+        header.faceCount = 1;
+        header.levelCount = (uint32_t)image.levels.size();
+
+        std::vector<uint32_t> dfd = dataFormatDescriptor(image.vkFormat);
+        std::vector<unsigned char> kvd;
+        for (const auto& item : image.keyValues)
+        {
+            uint32_t length = (uint32_t)(item.first.size() + 1 + item.second.size() + 1);
+            kvd.insert(kvd.end(), (const unsigned char*)&length, (const unsigned char*)&length + 4);
+            kvd.insert(kvd.end(), item.first.begin(), item.first.end());
+            kvd.push_back(0);
+            kvd.insert(kvd.end(), item.second.begin(), item.second.end());
+            kvd.push_back(0);
+            kvd.resize(align(kvd.size(), 4), 0);
+        }
+
+        uint64_t offset = sizeof(Header) + sizeof(LevelIndex) * image.levels.size();
+        header.dfdByteOffset = (uint32_t)offset;
+        header.dfdByteLength = (uint32_t)(dfd.size() * 4);
+        offset += header.dfdByteLength;
+        header.kvdByteOffset = kvd.empty() ? 0 : (uint32_t)offset;
+        header.kvdByteLength = (uint32_t)kvd.size();
+        offset += kvd.size();
+
+        // Уровни записываются от меньшего к большему, каждый выровнен по размеру блока
+        std::vector<LevelIndex> index(image.levels.size());
+        for (size_t i = image.levels.size(); i-- > 0;)
+        {
+            offset = align(offset, blockBytes(image.vkFormat));
+            index[i].byteOffset = offset;
+            index[i].byteLength = index[i].uncompressedByteLength = image.levels[i].size;
+            offset += image.levels[i].size;
+        }
+
+        std::string tempPath = path + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                std::cout << "ERROR::KTX2::CANNOT_WRITE " << path << std::endl;
+                return false;
+            }
+            file.write((const char*)&header, sizeof(header));
+            file.write((const char*)index.data(), (std::streamsize)(sizeof(LevelIndex) * index.size()));
+            file.write((const char*)dfd.data(), (std::streamsize)(dfd.size() * 4));
+            file.write((const char*)kvd.data(), (std::streamsize)kvd.size());
+            for (size_t i = image.levels.size(); i-- > 0;)
+            {
+                static const char zeros[16] = {};
+                file.write(zeros, (std::streamsize)(index[i].byteOffset - (uint64_t)file.tellp()));
+                file.write((const char*)image.levels[i].data, (std::streamsize)image.levels[i].size);
+            }
+            if (!file)
+            {
+                std::cout << "ERROR::KTX2::CANNOT_WRITE " << path << std::endl;
+                return false;
+            }
+        }
+        std::remove(path.c_str());
+        return std::rename(tempPath.c_str(), path.c_str()) == 0;
+    }
+
+    // Разбор отображенного файла. false - не KTX2, поврежден или использует суперсжатие/массивы/кубы/неизвестный формат.
+    // Размер каждого уровня сверяется с размером, следующим из формата и размеров уровня: иначе glCompressedTexImage2D
+    // прочитал бы данные чужого уровня или за концом файла
+    inline bool read(const MappedFile& file, Image& image)
+    {
+        if (!file.isOpen() || file.size() < sizeof(Header))
+            return false;
+        const Header* header = (const Header*)file.data();
+        if (std::memcmp(header->identifier, IDENTIFIER, sizeof(IDENTIFIER)) != 0 || header->supercompressionScheme != 0 ||
+            header->pixelDepth > 1 || header->layerCount > 1 || header->faceCount != 1 || header->pixelWidth == 0 || header->pixelHeight == 0)
+            return false;
+        if (!isBlockFormat(header->vkFormat))
+        {
+            std::cout << "ERROR::KTX2::UNSUPPORTED_FORMAT vkFormat " << header->vkFormat << std::endl;
+            return false;
+        }
+        uint32_t levelCount = header->levelCount ? header->levelCount : 1;
+        uint32_t fullChain = 1;
+        while (std::max(header->pixelWidth, header->pixelHeight) >> fullChain)
+            fullChain++;
+        if (levelCount > fullChain)
+            return false;
+        if (sizeof(Header) + sizeof(LevelIndex) * (uint64_t)levelCount > file.size() ||
+            (uint64_t)header->kvdByteOffset + header->kvdByteLength > file.size())
+            return false;
+
+        image.vkFormat = header->vkFormat;
+        image.width = header->pixelWidth;
+        image.height = header->pixelHeight;
+        image.levels.clear();
+        const LevelIndex* index = (const LevelIndex*)(file.data() + sizeof(Header));
+        for (uint32_t i = 0; i < levelCount; i++)
+        {
+            // Без сложения: byteOffset + byteLength из поддельного индекса может переполниться и пройти проверку
+            if (index[i].byteLength > file.size() || index[i].byteOffset > file.size() - index[i].byteLength)
+                return false;
+            uint64_t expected = levelBytes(header->vkFormat, header->pixelWidth, header->pixelHeight, i);
+            if (index[i].byteLength != expected)
+            {
+                std::cout << "ERROR::KTX2::LEVEL_SIZE level " << i << " is " << index[i].byteLength
+                          << " bytes, expected " << expected << std::endl;
+                return false;
+            }
+            image.levels.push_back({ file.data() + index[i].byteOffset, (size_t)index[i].byteLength });
+        }
+
+        image.keyValues.clear();
+        const unsigned char* kvd = file.data() + header->kvdByteOffset;
+        uint32_t position = 0;
+        while (position + 4 <= header->kvdByteLength)
+        {
+            uint32_t length;
+            std::memcpy(&length, kvd + position, 4);
+            if (length == 0 || position + 4 + length > header->kvdByteLength)
+                break;
+            const char* pair = (const char*)kvd + position + 4;
+            size_t keyLength = strnlen(pair, length);
+            if (keyLength < length)
+            {
+                size_t valueLength = length - keyLength - 1;
+                if (valueLength > 0 && pair[keyLength + valueLength] == 0)
+                    valueLength--; // завершающий ноль значения
+                image.keyValues[std::string(pair, keyLength)] = std::string(pair + keyLength + 1, valueLength);
+            }
+            position += (uint32_t)align(4 + length, 4);
+        }
+        return true;
+    }
+}
+#endif
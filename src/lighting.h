@@ -0,0 +1,82 @@
+#ifndef LIGHTING_H
+#define LIGHTING_H
+
+#include <glm/glm.hpp>
+#include <glm/gtc/color_space.hpp>
+
+#include "shader.h"
+#include "camera.h"
+
+// Источники света сцены: направленный свет, 4 точечных источника и прожектор-фонарик камеры.
+// Шейдер multiple_lights должен быть активирован заранее.
+// Цвета источников подобраны на глаз для вывода без гамма-коррекции, т.е. это значения в sRGB. Если кадр пишется
+// в sRGB-фреймбуфер (linear, см. Window::srgb), освещение считается в линейном пространстве, и цвета переводятся
+// в линейные: иначе фоновый свет 0.05 после кодирования в sRGB стал бы ~0.25 и сцена заметно посветлела бы.
+// Яркость освещенных поверхностей сохраняется, а затухание теперь применяется к линейной яркости, поэтому после
+// кодирования спад света точечных источников и прожектора с расстоянием выглядит мягче, чем без sRGB - это
+// намеренное изменение картинки. Цвет фона (белый) в обоих пространствах одинаков
+inline void setSceneLights(const Shader& shader, const glm::vec3 pointLightPositions[4], const Camera& camera, bool linear)
+{
+    auto color = [linear](float value) {
+        glm::vec3 c(value);
+        return linear ? glm::convertSRGBToLinear(c) : c;
+    };
+
+    shader.setVec3("viewPos", camera.Position);
+    shader.setFloat("material.shininess", 32.0f);
+
+    // Направленный свет
+    shader.setVec3("dirLight.direction", -0.2f, -1.0f, -0.3f);
+    shader.setVec3("dirLight.ambient", color(0.05f));
+    shader.setVec3("dirLight.diffuse", color(0.4f));
+    shader.setVec3("dirLight.specular", color(0.5f));
+
+    // Точечный источник света №1
+    shader.setVec3("pointLights[0].position", pointLightPositions[0]);
+    shader.setVec3("pointLights[0].ambient", color(0.05f));
+    shader.setVec3("pointLights[0].diffuse", color(0.8f));
+    shader.setVec3("pointLights[0].specular", color(1.0f));
+    shader.setFloat("pointLights[0].constant", 1.0f);
+    shader.setFloat("pointLights[0].linear", 0.09);
+    shader.setFloat("pointLights[0].quadratic", 0.032);
+
+    // Точечный источник света №2
+    shader.setVec3("pointLights[1].position", pointLightPositions[1]);
+    shader.setVec3("pointLights[1].ambient", color(0.05f));
+    shader.setVec3("pointLights[1].diffuse", color(0.8f));
+    shader.setVec3("pointLights[1].specular", color(1.0f));
+    shader.setFloat("pointLights[1].constant", 1.0f);
+    shader.setFloat("pointLights[1].linear", 0.09);
+    shader.setFloat("pointLights[1].quadratic", 0.032);
+
+    // Точечный источник света №3
+    shader.setVec3("pointLights[2].position", pointLightPositions[2]);
+    shader.setVec3("pointLights[2].ambient", color(0.05f));
+    shader.setVec3("pointLights[2].diffuse", color(0.8f));
+    shader.setVec3("pointLights[2].specular", color(1.0f));
+    shader.setFloat("pointLights[2].constant", 1.0f);
+    shader.setFloat("pointLights[2].linear", 0.09);
+    shader.setFloat("pointLights[2].quadratic", 0.032);
+
+    // Точечный источник света №4
+    shader.setVec3("pointLights[3].position", pointLightPositions[3]);
+    shader.setVec3("pointLights[3].ambient", color(0.05f));
+    shader.setVec3("pointLights[3].diffuse", color(0.8f));
+    shader.setVec3("pointLights[3].specular", color(1.0f));
+    shader.setFloat("pointLights[3].constant", 1.0f);
+    shader.setFloat("pointLights[3].linear", 0.09);
+    shader.setFloat("pointLights[3].quadratic", 0.032);
+
+    // Прожектор
+    shader.setVec3("spotLight.position", camera.Position);
+    shader.setVec3("spotLight.direction", camera.Front);
+    shader.setVec3("spotLight.ambient", color(0.0f));
+    shader.setVec3("spotLight.diffuse", color(1.0f));
+    shader.setVec3("spotLight.specular", color(1.0f));
+    shader.setFloat("spotLight.constant", 1.0f);
+    shader.setFloat("spotLight.linear", 0.09);
+    shader.setFloat("spotLight.quadratic", 0.032);
+    shader.setFloat("spotLight.cutOff", glm::cos(glm::radians(12.5f)));
+    shader.setFloat("spotLight.outerCutOff", glm::cos(glm::radians(15.0f)));
+}
+#endif
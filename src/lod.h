@@ -0,0 +1,49 @@
+#ifndef LOD_H
+#define LOD_H
+
+#include <glm/glm.hpp>
+
+// Выбор уровня детализации по размеру объекта на экране.
+// LOD 0 используется, пока ограничивающая сфера занимает не меньше baseSize пикселей по высоте,
+// каждый следующий уровень - при размере вдвое меньше предыдущего порога. Чтобы уровни не мерцали
+// на границе, переход на более грубый уровень происходит чуть ниже порога, а обратно - чуть выше
+struct LodView
+{
+    glm::vec3 cameraPosition;
+    float pixelScale = 1.0f;     // высота в пикселях объекта единичного размера на расстоянии 1
+    float baseSize = 256.0f;     // порог LOD 0 -> LOD 1 в пикселях
+    float hysteresis = 0.15f;    // относительная ширина зоны, в которой уровень не меняется
+
+    LodView() {}
+
+    // projection - перспективная матрица камеры, viewportHeight - высота области вывода в пикселях
+    LodView(const glm::vec3& cameraPosition, const glm::mat4& projection, float viewportHeight)
+        : cameraPosition(cameraPosition), pixelScale(projection[1][1] * viewportHeight * 0.5f)
+    {
+    }
+
+    // Высота сферы на экране в пикселях
+    float screenSize(const glm::vec3& center, float radius) const
+    {
+        float distance = glm::max(glm::length(center - cameraPosition), radius);
+        return 2.0f * radius * pixelScale / distance;
+    }
+
+    // Новый уровень с учетом текущего (current) для размера screenSize
+    int select(float screenSize, int current, int lodCount) const
+    {
+        if (lodCount <= 1)
+            return 0;
+        if (current < 0 || current >= lodCount)
+            current = lodCount - 1;
+        // Порог между уровнями lod - 1 и lod
+        auto threshold = [this](int lod) { return baseSize / (float)(1 << (lod - 1)); };
+        int lod = current;
+        while (lod + 1 < lodCount && screenSize < threshold(lod + 1) * (1.0f - hysteresis))
+            lod++;
+        while (lod > 0 && screenSize > threshold(lod) * (1.0f + hysteresis))
+            lod--;
+        return lod;
+    }
+};
+#endif
@@ -5,15 +5,26 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
-#include <SFML/Graphics.hpp>
-#include <SFML/OpenGL.hpp>
-
 #include "shader.h"
 #include "camera.h"
 #include "window.h"
+#include "transform.h"
+#include "gpu_profiler.h"
+#include "profiler.h"
+#include "camera_path.h"
+#include "benchmark.h"
+#include "render_stats.h"
+#include "cube.h"
+#include "world.h"
+#include "lighting.h"
+#include "texture_cache.h"
+#include "gpu_resources.h"
+#include "texture_atlas.h"
+#include "hud.h"
 //#include "events.h"
 
 #include <iostream>
+#include <cstring>
 #include "stb_image.h"
 /*
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
@@ -21,7 +32,6 @@ void mouse_callback(GLFWwindow* window, double xpos, double ypos);
 void scroll_callback(GLFWwindow* window, double xoffset, double yoffset);
 */
 void processInput(GLFWwindow* window);
-unsigned int loadTexture(const char* path);
 
 // Константы
 const unsigned int SCR_WIDTH = 600;
@@ -40,12 +50,37 @@ float lastFrame = 0.0f;
 // Освещение
 glm::vec3 lightPos(1.2f, 1.0f, 2.0f);
 
+// Профилирование GPU: F2 - выгрузка замеров в файлы, F3 - показать/скрыть оверлей (вместе с полосой видеопамяти)
+bool showGpuOverlay = true;
+bool dumpGpuProfile = false;
+
+// Запись траектории камеры для бенчмарков: F5 - начать/закончить запись в camera.path
+bool toggleRecording = false;
+
+// Учет видеопамяти: F7 - список объектов OpenGL в консоль и в gpu_resources.csv
+bool dumpGpuResources = false;
+
 // Массив кубов
 //int map[256][256];
 
-int main()
+// Запуск: Lesson1 [--benchmark [результат.json]]
+// В режиме бенчмарка окно не создается, камера летит по заданной траектории, а метрики кадров выводятся в JSON
+int main(int argc, char* argv[])
 {
-    Window::initialize(SCR_WIDTH, SCR_HEIGHT, "Window");
+    bool benchmarkMode = false;
+    const char* benchmarkOutput = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--benchmark") == 0)
+        {
+            benchmarkMode = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+                benchmarkOutput = argv[++i];
+        }
+    }
+
+    if (Window::initialize(SCR_WIDTH, SCR_HEIGHT, "Window", benchmarkMode) != 0)
+        return -1;
     //Events::initialize();
     // glfw: инициализация и конфигурирование
     /*glfwInit();
@@ -70,17 +105,12 @@ int main()
     glfwSetScrollCallback(window, scroll_callback);
     */
     // Сообщаем GLFW, чтобы он захватил наш курсор
-    Window::setCursorMode(GLFW_CURSOR_DISABLED);
+    if (!benchmarkMode)
+        Window::setCursorMode(GLFW_CURSOR_DISABLED);
 
     //glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
     
-
-    // glad: загрузка всех указателей на OpenGL-функции
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-    {
-        std::cout << "Failed to initialize GLAD" << std::endl;
-        return -1;
-    }
+    // glad: загрузка указателей на OpenGL-функции выполняется в Window::initialize
 
     // Конфигурирование глобального состояния OpenGL
     glEnable(GL_DEPTH_TEST);
@@ -88,62 +118,8 @@ int main()
     // Компилирование нашей шейдерной программы
     Shader lightingShader("../src/shaders/multiple_lights.vs", "../src/shaders/multiple_lights.fs");
     Shader lightCubeShader("../src/shaders/light_cube.vs", "../src/shaders/light_cube.fs");
-    Shader cursorShader("../src/shaders/cursor.vs", "../src/shaders/cursor.fs");
-
-    // Указание вершин (и буфера(ов)) и настройка вершинных атрибутов
-    float vertices[] = {
-        // координаты        // нормали           // текстурные координаты
-       -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.5f, 0.0f,
-        0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 0.0f,
-        0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 0.5f,
-        0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 0.5f,
-       -0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.5f, 0.5f,
-       -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.5f, 0.0f,
-
-       -0.5f, -0.5f,  0.5f,  0.0f,  0.0f, 1.0f,   0.5f, 0.0f,
-        0.5f, -0.5f,  0.5f,  0.0f,  0.0f, 1.0f,   1.0f, 0.0f,
-        0.5f,  0.5f,  0.5f,  0.0f,  0.0f, 1.0f,   1.0f, 0.5f,
-        0.5f,  0.5f,  0.5f,  0.0f,  0.0f, 1.0f,   1.0f, 0.5f,
-       -0.5f,  0.5f,  0.5f,  0.0f,  0.0f, 1.0f,   0.5f, 0.5f,
-       -0.5f, -0.5f,  0.5f,  0.0f,  0.0f, 1.0f,   0.5f, 0.0f,
-
-       -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.5f,
-       -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.5f, 0.5f,
-       -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.5f, 0.0f,
-       -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.5f, 0.0f,
-       -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
-       -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.5f,
-
-        0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.5f, 0.5f,
-        0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.5f,
-        0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
-        0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.0f,
-        0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.5f, 0.0f,
-        0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.5f, 0.5f,
-
-       -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 0.5f,
-        0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.5f, 0.5f,
-        0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.5f, 0.0f,
-        0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.5f, 0.0f,
-       -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 0.0f,
-       -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 0.5f,
-
-       -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f,
-        0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.5f, 1.0f,
-        0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.5f, 0.5f,
-        0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.5f, 0.5f,
-       -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 0.5f,
-       -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f,
-    };
-
-    float cursor[] = {
 
-        -0.03f,  0.0f,
-         0.03f,  0.0f,
-
-         0.0f,   0.04f,
-         0.0f,  -0.04f,
-    };
+    // Указание вершин (и буфера(ов)) и настройка вершинных атрибутов; вершины куба вынесены в cube.h
 
     // Координаты точечных источников света
     glm::vec3 pointLightPositions[] = {
@@ -157,9 +133,11 @@ int main()
     unsigned int VBO, cubeVAO;
     glGenVertexArrays(1, &cubeVAO);
     glGenBuffers(1, &VBO);
+    gpuResources().add(GpuResources::VertexArray, cubeVAO, "cube");
+    gpuResources().addBuffer(VBO, GL_ARRAY_BUFFER, sizeof(cubeVertices), "cube");
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
 
     glBindVertexArray(cubeVAO);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
@@ -172,6 +150,7 @@ int main()
     // 2. Настраиваем VAO света (VBO остается неизменным; вершины те же и для светового объекта, который также является 3D-кубом)
     unsigned int lightCubeVAO;;
     glGenVertexArrays(1, &lightCubeVAO);
+    gpuResources().add(GpuResources::VertexArray, lightCubeVAO, "light cube");
     glBindVertexArray(lightCubeVAO);
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
@@ -180,40 +159,61 @@ int main()
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
 
-    // 3. Настраиваем VAO перекрестия
-    unsigned int cursorVBO, cursorVAO;
-    glGenVertexArrays(1, &cursorVAO);
-    glGenBuffers(1, &cursorVBO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, cursorVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(cursor), cursor, GL_STATIC_DRAW);
-
-    glBindVertexArray(cursorVAO);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    // Загрузка текстур
-    unsigned int diffuseMap = loadTexture("../res/textures/wooden_container_2.png");
-    unsigned int specularMap = loadTexture("../res/textures/container_2_specular.png");
-    unsigned int grassBlock = loadTexture("../res/textures/grass_block.png");
-
-    sf::Image im;
-    im.loadFromFile("../res/textures/heightmap.png");
+    // Загрузка текстур одним пакетом (через общий кэш текстур, см. texture_cache.h): файлы декодируются параллельно
+    PROFILE_THREAD_NAME("main");
+    // Цветовые карты в sRGB, карта отражений - линейные данные
+    TextureParams colorMap;
+    colorMap.srgb = true;
+    textureCache().setSrgbEnabled(Window::srgb);
+    std::vector<unsigned int> textures = textureCache().load({
+        { "../res/textures/wooden_container_2.png", colorMap },
+        { "../res/textures/container_2_specular.png", TextureParams() },
+        { "../res/textures/grass_block.png", colorMap },
+    });
+    unsigned int diffuseMap = textures[0];
+    unsigned int specularMap = textures[1];
+    unsigned int grassBlock = textures[2];
+
+    // Значки интерфейса в атласе: перекрестие и все остальные рисуются одним вызовом
+    TextureAtlas atlas(Window::srgb);
+    std::vector<std::string> iconFiles = {
+        "../res/textures/crosshair.png",
+        "../res/textures/awesomeface.png",
+    };
+    std::vector<TextureAtlas::Region> icons = atlas.add(iconFiles);
+    Hud hud(atlas);
 
+    // Мир для отрисовки из карты высот (map остается для столкновений камеры)
+    World world = World::fromHeightmap("../res/textures/heightmap.png", 256, 256);
     for (int x = 0; x < 256; x++)
-    {
         for (int z = 0; z < 256; z++)
-        {
-            int c = im.getPixel(x, z).r / 15;
-            map[x][z] = c;
-        }
-    };
+            map[x][z] = world.height(x, z);
 
     // Конфигурация шейдеров
     lightingShader.use();
     lightingShader.setInt("material.diffuse", 0);
     lightingShader.setInt("material.specular", 1);
 
+    // Профилировщик GPU и его проходы (будущий проход теней регистрируется так же)
+    Overlay overlay;
+    GpuProfiler gpuProfiler;
+    int terrainPass = gpuProfiler.addPass("terrain");
+    int lightCubesPass = gpuProfiler.addPass("light cubes");
+    int hudPass = gpuProfiler.addPass("hud");
+    float lastTitleUpdate = 0.0f;
+
+    // Бенчмарк: траектория камеры воспроизводится с фиксированным шагом 1/60 с
+    CameraPath cameraPath = CameraPath::flyover();
+    BenchmarkRunner benchmark;
+    float pathTime = 0.0f;
+    if (benchmarkMode)
+        showGpuOverlay = false;
+
+    // Запись траектории: ключевой кадр каждые 0.25 с
+    CameraPath recordedPath;
+    bool recording = false;
+    float recordStart = 0.0f, lastRecordedKey = 0.0f;
+
     // Цикл рендеринга
     while (!Window::isShouldClose())
     {
@@ -222,74 +222,61 @@ int main()
         deltaTime = currentFrame - lastFrame;
         lastFrame = currentFrame;
 
-        // Обработка ввода
-        processInput(Window::window);
+        PROFILE_SCOPE("frame");
+        gpuProfiler.beginFrame();
+        renderStats().reset();
+        textureStreamer().update(); // мип-уровни по размерам моделей на экране в прошлом кадре
+
+        if (toggleRecording)
+        {
+            toggleRecording = false;
+            recording = !recording;
+            if (recording)
+            {
+                recordedPath.keys.clear();
+                recordStart = currentFrame;
+                lastRecordedKey = -1.0f;
+            }
+            else if (recordedPath.save("camera.path"))
+                std::cout << "Camera path saved: camera.path (" << recordedPath.keys.size() << " keys)" << std::endl;
+        }
+        if (recording && currentFrame - recordStart - lastRecordedKey >= 0.25f)
+        {
+            lastRecordedKey = currentFrame - recordStart;
+            recordedPath.add(lastRecordedKey, camera.Position, camera.Yaw, camera.Pitch);
+        }
+
+        if (benchmarkMode)
+        {
+            deltaTime = 1.0f / 60.0f;
+            benchmark.beginFrame();
+            cameraPath.apply(camera, pathTime);
+            pathTime += deltaTime;
+        }
+        else
+        {
+            // Обработка ввода
+            {
+                PROFILE_SCOPE("input");
+                processInput(Window::window);
+            }
 
-        camera.Collision(deltaTime);
+            {
+                PROFILE_SCOPE("collision");
+                camera.Collision(deltaTime);
+            }
+        }
 
         // Рендеринг
         glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // Убеждаемся, что активировали шейдер прежде, чем настраивать uniform-переменные/объекты_рисования
-        lightingShader.use();
-        lightingShader.setVec3("viewPos", camera.Position);
-        lightingShader.setFloat("material.shininess", 32.0f);
-
-
-        // Направленный свет
-        lightingShader.setVec3("dirLight.direction", -0.2f, -1.0f, -0.3f);
-        lightingShader.setVec3("dirLight.ambient", 0.05f, 0.05f, 0.05f);
-        lightingShader.setVec3("dirLight.diffuse", 0.4f, 0.4f, 0.4f);
-        lightingShader.setVec3("dirLight.specular", 0.5f, 0.5f, 0.5f);
-
-        // Точечный источник света №1
-        lightingShader.setVec3("pointLights[0].position", pointLightPositions[0]);
-        lightingShader.setVec3("pointLights[0].ambient", 0.05f, 0.05f, 0.05f);
-        lightingShader.setVec3("pointLights[0].diffuse", 0.8f, 0.8f, 0.8f);
-        lightingShader.setVec3("pointLights[0].specular", 1.0f, 1.0f, 1.0f);
-        lightingShader.setFloat("pointLights[0].constant", 1.0f);
-        lightingShader.setFloat("pointLights[0].linear", 0.09);
-        lightingShader.setFloat("pointLights[0].quadratic", 0.032);
-
-        // Точечный источник света №2
-        lightingShader.setVec3("pointLights[1].position", pointLightPositions[1]);
-        lightingShader.setVec3("pointLights[1].ambient", 0.05f, 0.05f, 0.05f);
-        lightingShader.setVec3("pointLights[1].diffuse", 0.8f, 0.8f, 0.8f);
-        lightingShader.setVec3("pointLights[1].specular", 1.0f, 1.0f, 1.0f);
-        lightingShader.setFloat("pointLights[1].constant", 1.0f);
-        lightingShader.setFloat("pointLights[1].linear", 0.09);
-        lightingShader.setFloat("pointLights[1].quadratic", 0.032);
-
-        // Точечный источник света №3
-        lightingShader.setVec3("pointLights[2].position", pointLightPositions[2]);
-        lightingShader.setVec3("pointLights[2].ambient", 0.05f, 0.05f, 0.05f);
-        lightingShader.setVec3("pointLights[2].diffuse", 0.8f, 0.8f, 0.8f);
-        lightingShader.setVec3("pointLights[2].specular", 1.0f, 1.0f, 1.0f);
-        lightingShader.setFloat("pointLights[2].constant", 1.0f);
-        lightingShader.setFloat("pointLights[2].linear", 0.09);
-        lightingShader.setFloat("pointLights[2].quadratic", 0.032);
-
-        // Точечный источник света №4
-        lightingShader.setVec3("pointLights[3].position", pointLightPositions[3]);
-        lightingShader.setVec3("pointLights[3].ambient", 0.05f, 0.05f, 0.05f);
-        lightingShader.setVec3("pointLights[3].diffuse", 0.8f, 0.8f, 0.8f);
-        lightingShader.setVec3("pointLights[3].specular", 1.0f, 1.0f, 1.0f);
-        lightingShader.setFloat("pointLights[3].constant", 1.0f);
-        lightingShader.setFloat("pointLights[3].linear", 0.09);
-        lightingShader.setFloat("pointLights[3].quadratic", 0.032);
-
-        // Прожектор
-        lightingShader.setVec3("spotLight.position", camera.Position);
-        lightingShader.setVec3("spotLight.direction", camera.Front);
-        lightingShader.setVec3("spotLight.ambient", 0.0f, 0.0f, 0.0f);
-        lightingShader.setVec3("spotLight.diffuse", 1.0f, 1.0f, 1.0f);
-        lightingShader.setVec3("spotLight.specular", 1.0f, 1.0f, 1.0f);
-        lightingShader.setFloat("spotLight.constant", 1.0f);
-        lightingShader.setFloat("spotLight.linear", 0.09);
-        lightingShader.setFloat("spotLight.quadratic", 0.032);
-        lightingShader.setFloat("spotLight.cutOff", glm::cos(glm::radians(12.5f)));
-        lightingShader.setFloat("spotLight.outerCutOff", glm::cos(glm::radians(15.0f)));
+        {
+            PROFILE_SCOPE("uniform upload");
+            // Убеждаемся, что активировали шейдер прежде, чем настраивать uniform-переменные/объекты_рисования
+            lightingShader.use();
+            setSceneLights(lightingShader, pointLightPositions, camera, Window::srgb);
+        }
 
         // Преобразования Вида/Проекции
         glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
@@ -301,66 +288,126 @@ int main()
         glm::mat4 model = glm::mat4(1.0f);
         lightingShader.setMat4("model", model);
 
+        // Кубы террейна только переносятся, поэтому матрица нормалей для них единичная и задается один раз за кадр
+        lightingShader.setMat3("normalMatrix", NormalMatrix(model));
+
         // Связывание диффузной карты
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, grassBlock);
+        samplerCache().bind(0);
 
         // Связывание карты отраженного цвета
         //glActiveTexture(GL_TEXTURE1);
         //glBindTexture(GL_TEXTURE_2D, specularMap);
 
         // Рендеринг контейнеров
-        glBindVertexArray(cubeVAO);
-        for (int x = 0; x < 40; x++)
         {
-            for (int z = 0; z < 40; z++)
-            {
-                for (int y = 0; map[x][z] > y; y++)
-                {
-                    // Вычисляем матрицу модели для каждого объекта и передаем её в шейдер
-                    glm::mat4 model = glm::mat4(1.0f);
-                    model = glm::translate(model, glm::vec3((float)x + 0.5f, (float)y, (float)z + 0.5f));
-                    lightingShader.setMat4("model", model);
-                    glDrawArrays(GL_TRIANGLES, 0, 36);
-                }
-            }
+            PROFILE_SCOPE("draw terrain");
+            GpuProfiler::Scope scope(gpuProfiler, terrainPass);
+            glBindVertexArray(cubeVAO);
+            world.draw(lightingShader, 0, 0, 40, 40);
         }
 
 
         // Также отрисовываем объект лампы
-        lightCubeShader.use();
-        lightCubeShader.setMat4("projection", projection);
-        lightCubeShader.setMat4("view", view);
+        {
+            PROFILE_SCOPE("draw light cubes");
+            GpuProfiler::Scope scope(gpuProfiler, lightCubesPass);
+            lightCubeShader.use();
+            lightCubeShader.setMat4("projection", projection);
+            lightCubeShader.setMat4("view", view);
+
+            // А теперь мы отрисовываем столько ламп, сколько у нас есть точечных источников света
+            glBindVertexArray(lightCubeVAO);
+            for (unsigned int i = 0; i < 4; i++)
+            {
+                model = glm::mat4(1.0f);
+                model = glm::translate(model, pointLightPositions[i]);
+                model = glm::scale(model, glm::vec3(0.2f)); // меньший куб
+                lightCubeShader.setMat4("model", model);
+                glDrawArrays(GL_TRIANGLES, 0, 36);
+                renderStats().draw(12);
+            }
+        }
 
-        // А теперь мы отрисовываем столько ламп, сколько у нас есть точечных источников света
-        glBindVertexArray(lightCubeVAO);
-        for (unsigned int i = 0; i < 4; i++)
+        // Интерфейс: перекрестие в центре и значок в левом нижнем углу (размеры в пикселях переводятся в NDC)
         {
-            model = glm::mat4(1.0f);
-            model = glm::translate(model, pointLightPositions[i]);
-            model = glm::scale(model, glm::vec3(0.2f)); // меньший куб
-            lightCubeShader.setMat4("model", model);
-            glDrawArrays(GL_TRIANGLES, 0, 36);
+            PROFILE_SCOPE("draw hud");
+            GpuProfiler::Scope scope(gpuProfiler, hudPass);
+            glm::vec2 pixel(2.0f / SCR_WIDTH, 2.0f / SCR_HEIGHT);
+            hud.sprite(icons[0], glm::vec2(0.0f), 24.0f * pixel, glm::vec4(0.5f, 0.5f, 0.5f, 1.0f));
+            hud.sprite(icons[1], glm::vec2(-1.0f) + 40.0f * pixel, 48.0f * pixel);
+            hud.draw();
         }
 
-        // Курсор
-        cursorShader.use();
-        // А теперь мы отрисовываем курсор
-        glBindVertexArray(cursorVAO);
-        glLineWidth(3);
-        glDrawArrays(GL_LINES, 0, 4);
+        // Оверлей профилировщика и сводка в заголовке окна (дважды в секунду)
+        gpuProfiler.endFrame();
+        if (showGpuOverlay)
+        {
+            gpuProfiler.drawOverlay(overlay);
+            gpuResources().drawOverlay(overlay);
+        }
+        if (currentFrame - lastTitleUpdate > 0.5f)
+        {
+            glfwSetWindowTitle(Window::window, (gpuProfiler.summary() + " | " + gpuResources().summary()).c_str());
+            lastTitleUpdate = currentFrame;
+        }
+        if (dumpGpuResources)
+        {
+            gpuResources().dump(std::cout);
+            gpuResources().dumpCsv("gpu_resources.csv");
+            dumpGpuResources = false;
+        }
+        if (dumpGpuProfile)
+        {
+            gpuProfiler.dumpCsv("gpu_profile.csv");
+            gpuProfiler.dumpChromeTrace("gpu_trace.json");
+            PROFILE_DUMP("cpu_trace.json");
+            dumpGpuProfile = false;
+        }
 
         // glfw: обмен содержимым front- и back- буферов. Отслеживание событий ввода/вывода (была ли нажата/отпущена кнопка, перемещен курсор мыши и т.п.)
-        Window::swapBuffers();
-        //Events::pullEvents();
-        //glfwSwapBuffers(Window::window);
-        glfwPollEvents();
+        {
+            PROFILE_SCOPE("swap");
+            Window::swapBuffers();
+            //Events::pullEvents();
+            //glfwSwapBuffers(Window::window);
+            glfwPollEvents();
+        }
+
+        if (benchmarkMode)
+        {
+            // Кадр бенчмарка все равно дожидается GPU (glFinish в BenchmarkRunner::endFrame), поэтому запросы
+            // читаются сразу, и время GPU относится к этому кадру, а не к кадру FRAMES_IN_FLIGHT назад
+            gpuProfiler.drain();
+            benchmark.endFrame(gpuProfiler.latest(terrainPass) + gpuProfiler.latest(lightCubesPass) + gpuProfiler.latest(hudPass));
+            if (pathTime > cameraPath.duration())
+                Window::setShouldClose(true);
+        }
+    }
+
+    if (benchmarkMode)
+    {
+        if (benchmarkOutput)
+            benchmark.writeJson(benchmarkOutput, "flyover");
+        else
+            benchmark.writeJson(std::cout, "flyover");
     }
 
     // Опционально: освобождаем все ресурсы, как только они выполнили свое предназначение
+    gpuResources().remove(GpuResources::VertexArray, cubeVAO);
+    gpuResources().remove(GpuResources::VertexArray, lightCubeVAO);
+    gpuResources().remove(GpuResources::Buffer, VBO);
     glDeleteVertexArrays(1, &cubeVAO);
     glDeleteVertexArrays(1, &lightCubeVAO);
     glDeleteBuffers(1, &VBO);
+    hud.release();
+    atlas.release();
+    PROFILE_DUMP("cpu_trace.json");
+    gpuProfiler.release();
+    overlay.release();
+    textureCache().release();
+    samplerCache().release();
 
     // glfw: завершение, освобождение всех выделенных ранее GLFW-реcурсов
     Window::terminate();
@@ -374,6 +421,37 @@ void processInput(GLFWwindow* window)
     if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
         Window::setShouldClose(true);
 
+    // Клавиши профилировщика и настройки качества срабатывают один раз на нажатие
+    static bool f2Pressed = false, f3Pressed = false, f5Pressed = false, f6Pressed = false, f7Pressed = false;
+    bool f2 = glfwGetKey(window, GLFW_KEY_F2) == GLFW_PRESS;
+    bool f3 = glfwGetKey(window, GLFW_KEY_F3) == GLFW_PRESS;
+    bool f5 = glfwGetKey(window, GLFW_KEY_F5) == GLFW_PRESS;
+    bool f6 = glfwGetKey(window, GLFW_KEY_F6) == GLFW_PRESS;
+    bool f7 = glfwGetKey(window, GLFW_KEY_F7) == GLFW_PRESS;
+    if (f2 && !f2Pressed)
+        dumpGpuProfile = true;
+    if (f3 && !f3Pressed)
+        showGpuOverlay = !showGpuOverlay;
+    if (f5 && !f5Pressed)
+        toggleRecording = true;
+    if (f7 && !f7Pressed)
+        dumpGpuResources = true;
+    f2Pressed = f2;
+    f3Pressed = f3;
+    f5Pressed = f5;
+    f7Pressed = f7;
+
+    // F6: анизотропная фильтрация 1x -> 2x -> 4x -> 8x -> 16x -> 1x (в пределах возможностей драйвера)
+    if (f6 && !f6Pressed)
+    {
+        float level = samplerCache().getAnisotropy() * 2.0f;
+        samplerCache().setAnisotropy(level > 16.0f ? 1.0f : level);
+        if (samplerCache().getAnisotropy() < level && level <= 16.0f)
+            samplerCache().setAnisotropy(1.0f);
+        std::cout << "Anisotropic filtering: " << samplerCache().getAnisotropy() << "x" << std::endl;
+    }
+    f6Pressed = f6;
+
     if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
         camera.ProcessKeyboard(FORWARD, NO, NO, deltaTime);
     if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
@@ -418,43 +496,3 @@ void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
 {
     camera.ProcessMouseScroll(yoffset);
 }
-
-// Функция для загрузки 2D-текстуры из файла
-unsigned int loadTexture(char const* path)
-{
-    stbi_set_flip_vertically_on_load(true);
-
-    unsigned int textureID;
-    glGenTextures(1, &textureID);
-
-    int width, height, nrComponents;
-    unsigned char* data = stbi_load(path, &width, &height, &nrComponents, 0);
-    if (data)
-    {
-        GLenum format;
-        if (nrComponents == 1)
-            format = GL_RED;
-        else if (nrComponents == 3)
-            format = GL_RGB;
-        else if (nrComponents == 4)
-            format = GL_RGBA;
-
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        stbi_image_free(data);
-    }
-    else
-    {
-        std::cout << "Texture failed to load at path: " << path << std::endl;
-        stbi_image_free(data);
-    }
-
-    return textureID;
-}
\ No newline at end of file
@@ -7,29 +7,16 @@
 #include <glm/gtc/matrix_transform.hpp>
  
 #include "shader.h" // shader.h идентичен файлу shader_s.h
+#include "vertex.h"
+#include "geometry_pool.h"
+#include "render_stats.h"
+#include "sampler_cache.h"
  
 #include <string>
+#include <utility>
 #include <vector>
 using namespace std;
  
-struct Vertex {
- 
-    // Позиция
-    glm::vec3 Position;
- 
-    // Нормаль
-    glm::vec3 Normal;
- 
-    // Текстурные координаты
-    glm::vec2 TexCoords;
- 
-    // Касательный вектор
-    glm::vec3 Tangent;
- 
-    // Вектор бинормали (вектор, перпендикулярный касательному вектору и вектору нормали)
-    glm::vec3 Bitangent;
-};
- 
 struct Texture {
     unsigned int id;
     string type;
@@ -42,104 +29,158 @@ public:
     vector<Vertex> vertices;
     vector<unsigned int> indices;
     vector<Texture> textures;
-    unsigned int VAO;
+    vector<VertexBones> bones; // кости вершин (пусто у меша без костей)
+    unsigned int VAO;        // общий VAO пула геометрии
+    GeometryPool::Range range; // положение вершин и индексов меша в буферах пула
+    vector<GeometryPool::Range> lods; // уровни детализации: lods[0] - сам меш, далее упрощенные индексы для тех же вершин
+    vector<vector<unsigned int>> lodIndices; // копия индексов уровней 1..N в памяти CPU (для кэша)
+    glm::vec3 boundsMin, boundsMax; // ограничивающий параллелепипед в координатах модели
+ 
+    // Материал, подготовленный для отрисовки: i-я текстура привязывается к юниту i под именем сэмплера
+    // samplerNames[i] ("texture_diffuse1", ...). Location сэмплеров хранятся для каждой программы, которой
+    // рисовался меш (обычно одной-двух, например обычной и instanced), поэтому поиск нужен один раз на программу
+    struct ProgramSamplers {
+        unsigned int program;
+        vector<GLint> samplers;
+    };
+    struct MaterialBinding {
+        vector<string> samplerNames;
+        vector<unsigned int> textureIds;
+        vector<ProgramSamplers> programs;
+    };
+    MaterialBinding material;
+ 
+    // Конструктор. Массивы принимаются по значению и перемещаются в члены класса, поэтому при передаче
+    // через std::move данные вершин не копируются. quantization нужен, только если пул хранит сжатые вершины.
+    // bones - кости вершин анимированного меша (по одной записи на вершину) или пустой массив
+    Mesh(vector<Vertex> vertices, vector<unsigned int> indices, vector<Texture> textures, GeometryPool &pool,
+         const VertexQuantization &quantization = VertexQuantization(), vector<VertexBones> bones = vector<VertexBones>())
+        : vertices(std::move(vertices)), indices(std::move(indices)), textures(std::move(textures)), bones(std::move(bones))
+    {
+        // Теперь, когда у нас есть все необходимые данные, загружаем их в общие буферы
+        setupMesh(pool, this->vertices.data(), this->vertices.size(), this->indices.data(), this->indices.size(), quantization,
+                  this->bones.empty() ? nullptr : this->bones.data());
+    }
  
-    // Конструктор
-    Mesh(vector<Vertex> vertices, vector<unsigned int> indices, vector<Texture> textures)
+    // Конструктор для готовых данных (например, из отображенного в память кэша mesh_cache.h):
+    // вершины и индексы сразу загружаются в буферы OpenGL, копия в памяти CPU не сохраняется
+    Mesh(const Vertex* vertexData, size_t vertexCount, const unsigned int* indexData, size_t indexCount, vector<Texture> textures, GeometryPool &pool,
+         const VertexQuantization &quantization = VertexQuantization())
+        : textures(std::move(textures))
     {
-        this->vertices = vertices;
-        this->indices = indices;
-        this->textures = textures;
+        setupMesh(pool, vertexData, vertexCount, indexData, indexCount, quantization);
+    }
+ 
+    // Освобождаем копию вершин и индексов в памяти CPU: после загрузки в буферы OpenGL для отрисовки она не нужна
+    void releaseCpuData()
+    {
+        vector<Vertex>().swap(vertices);
+        vector<unsigned int>().swap(indices);
+        vector<VertexBones>().swap(bones);
+        vector<vector<unsigned int>>().swap(lodIndices);
+    }
  
-        // Теперь, когда у нас есть все необходимые данные, устанавливаем вершинные буферы и указатели атрибутов
-        setupMesh();
+    // Добавляем следующий уровень детализации (индексы ссылаются на вершины этого же меша)
+    void addLod(vector<unsigned int> indices, GeometryPool &pool)
+    {
+        addLod(indices.data(), indices.size(), pool);
+        lodIndices.push_back(std::move(indices));
+    }
+ 
+    void addLod(const unsigned int* indexData, size_t indexCount, GeometryPool &pool)
+    {
+        lods.push_back(pool.allocateIndices(indexData, indexCount, range));
     }
  
     // Рендеринг меша
-    void Draw(Shader &shader) 
+    void Draw(const Shader &shader) 
+    {
+        bindTextures(shader);
+        
+        // Отрисовываем меш
+        glBindVertexArray(VAO);
+        glDrawElementsBaseVertex(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT, range.indexOffset(), range.baseVertex);
+        glBindVertexArray(0);
+        renderStats().draw(range.indexCount / 3);
+ 
+        // Считается хорошей практикой возвращать значения переменных к их первоначальным значениям
+        glActiveTexture(GL_TEXTURE0);
+    }
+ 
+    // Связываем текстуры меша с сэмплерами шейдера. Location сэмплеров ищутся только при первой
+    // отрисовке с новой программой, поэтому в обычном кадре здесь нет выделений памяти
+    void bindTextures(const Shader &shader)
+    {
+        const vector<GLint> &samplers = samplersFor(shader.ID);
+        for(unsigned int i = 0; i < material.textureIds.size(); i++)
+        {
+            glActiveTexture(GL_TEXTURE0 + i); // перед связыванием активируем нужный текстурный юнит
+            // Теперь устанавливаем сэмплер на нужный текстурный юнит
+            glUniform1i(samplers[i], i);
+            // и связываем текстуру с общим сэмплером (фильтрация и анизотропия задаются в samplerCache())
+            glBindTexture(GL_TEXTURE_2D, material.textureIds[i]);
+            samplerCache().bind(i);
+        }
+    }
+ 
+    // Одинаковые ли у мешей текстуры (такие меши можно рисовать одним вызовом)
+    bool sameMaterial(const Mesh &other) const
+    {
+        if(textures.size() != other.textures.size())
+            return false;
+        for(size_t i = 0; i < textures.size(); i++)
+            if(textures[i].id != other.textures[i].id || textures[i].type != other.textures[i].type)
+                return false;
+        return true;
+    }
+ 
+private:
+    // Загружаем вершины и индексы в общие буферы пула
+    void setupMesh(GeometryPool &pool, const Vertex* vertexData, size_t vertexCount, const unsigned int* indexData, size_t indexCount,
+                   const VertexQuantization &quantization, const VertexBones* boneData = nullptr)
     {
-        // Связываем соответствующие текстуры
+        range = pool.allocate(vertexData, vertexCount, indexData, indexCount, quantization, boneData);
+        lods.push_back(range);
+        VAO = pool.VAO;
+        boundsMin = boundsMax = vertexCount ? vertexData[0].Position : glm::vec3(0.0f);
+        for(size_t i = 1; i < vertexCount; i++)
+        {
+            boundsMin = glm::min(boundsMin, vertexData[i].Position);
+            boundsMax = glm::max(boundsMax, vertexData[i].Position);
+        }
+        // Получаем номер текстуры (номер N в diffuse_textureN)
         unsigned int diffuseNr = 1;
         unsigned int specularNr = 1;
         unsigned int normalNr = 1;
         unsigned int heightNr = 1;
-        for(unsigned int i = 0; i < textures.size(); i++)
+        for(const Texture &texture : textures)
         {
-            glActiveTexture(GL_TEXTURE0 + i); // перед связыванием активируем нужный текстурный юнит
-            // Получаем номер текстуры (номер N в diffuse_textureN)
             string number;
-            string name = textures[i].type;
+            const string &name = texture.type;
             if(name == "texture_diffuse")
                 number = std::to_string(diffuseNr++);
             else if(name == "texture_specular")
                 number = std::to_string(specularNr++); // конвертируем unsigned int в строку
             else if(name == "texture_normal")
                 number = std::to_string(normalNr++); // конвертируем unsigned int в строку
-             else if(name == "texture_height")
+            else if(name == "texture_height")
                 number = std::to_string(heightNr++); // конвертируем unsigned int в строку
- 
-            // Теперь устанавливаем сэмплер на нужный текстурный юнит
-            glUniform1i(glGetUniformLocation(shader.ID, (name + number).c_str()), i);
-            // и связываем текстуру
-            glBindTexture(GL_TEXTURE_2D, textures[i].id);
+            material.samplerNames.push_back(name + number);
+            material.textureIds.push_back(texture.id);
         }
-        
-        // Отрисовываем меш
-        glBindVertexArray(VAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
-        glBindVertexArray(0);
- 
-        // Считается хорошей практикой возвращать значения переменных к их первоначальным значениям
-        glActiveTexture(GL_TEXTURE0);
     }
- 
-private:
-    // Данные для рендеринга 
-    unsigned int VBO, EBO;
- 
-    // Инициализируем все буферные объекты/массивы
-    void setupMesh()
+
+    // Location сэмплеров в программе; для новой программы ищутся по готовым именам и запоминаются
+    const vector<GLint> &samplersFor(unsigned int program)
     {
-        // Создаем буферные объекты/массивы
-        glGenVertexArrays(1, &VAO);
-        glGenBuffers(1, &VBO);
-        glGenBuffers(1, &EBO);
- 
-        glBindVertexArray(VAO);
- 
-        // Загружаем данные в вершинный буфер
-        glBindBuffer(GL_ARRAY_BUFFER, VBO);
- 
-        // Самое замечательное в структурах то, что расположение в памяти их внутренних переменных является последовательным.
-        // Смысл данного трюка в том, что мы можем просто передать указатель на структуру, и она прекрасно преобразуется в массив данных с элементами типа glm::vec3 (или glm::vec2), который затем будет преобразован в массив данных float, ну а в конце – в байтовый массив
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), &vertices[0], GL_STATIC_DRAW);  
- 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
- 
-        // Устанавливаем указатели вершинных атрибутов
- 
-        // Координаты вершин
-        glEnableVertexAttribArray(0);	
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
- 
-        // Нормали вершин
-        glEnableVertexAttribArray(1);	
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
- 
-        // Текстурные координаты вершин
-        glEnableVertexAttribArray(2);	
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
- 
-        // Касательный вектор вершины
-        glEnableVertexAttribArray(3);
-        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Tangent));
- 
-        // Вектор бинормали вершины
-        glEnableVertexAttribArray(4);
-        glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Bitangent));
- 
-        glBindVertexArray(0);
+        for(const ProgramSamplers &entry : material.programs)
+            if(entry.program == program)
+                return entry.samplers;
+        material.programs.push_back({ program, vector<GLint>() });
+        vector<GLint> &samplers = material.programs.back().samplers;
+        for(const string &name : material.samplerNames)
+            samplers.push_back(glGetUniformLocation(program, name.c_str()));
+        return samplers;
     }
 };
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,235 @@
+#ifndef MESH_CACHE_H
+#define MESH_CACHE_H
+
+#include "mesh.h"
+#include "mapped_file.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Двоичный кэш ("запеченная" модель): готовые массивы Vertex/индексов и таблица материалов.
+// Файл отображается в память, и вершины загружаются в буферы OpenGL прямо из него, без Assimp и без
+// преобразования каждой вершины. Кэш считается устаревшим при изменении хэша исходного файла,
+// флагов импорта, версии формата или размера Vertex.
+//
+// Формат (все блоки выровнены по ALIGNMENT байт):
+//   Header | MeshEntry[meshCount] | LodEntry[lodCount] | TextureEntry[textureCount] |
+//   вершины, индексы и индексы уровней детализации каждого меша
+namespace MeshCache
+{
+    const uint32_t VERSION = 5;
+    const uint32_t ALIGNMENT = 64;
+    const char MAGIC[8] = { 'L', '1', 'M', 'E', 'S', 'H', 0, 0 };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t vertexSize;
+        uint64_t sourceHash;
+        uint32_t importFlags;
+        uint32_t meshCount;
+        uint32_t textureCount;
+        uint32_t lodCount;
+    };
+
+    struct MeshEntry {
+        uint64_t vertexOffset;
+        uint64_t indexOffset;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        uint32_t firstTexture;
+        uint32_t textureCount;
+        uint32_t firstLod;
+        uint32_t lodCount;
+    };
+
+    // Дополнительный уровень детализации: индексы для вершин того же меша
+    struct LodEntry {
+        uint64_t indexOffset;
+        uint32_t indexCount;
+        uint32_t reserved;
+    };
+
+    struct TextureEntry {
+        char type[32];
+        char path[224];
+    };
+
+    // Меш, данные которого указывают прямо в отображенный файл
+    struct BakedMesh {
+        const Vertex* vertices;
+        uint32_t vertexCount;
+        const unsigned int* indices;
+        uint32_t indexCount;
+        const TextureEntry* textures;
+        uint32_t textureCount;
+        const LodEntry* lods;
+        uint32_t lodCount;
+        const unsigned char* base; // начало файла, от которого отсчитываются смещения LodEntry
+
+        const unsigned int* lodIndices(uint32_t lod) const
+        {
+            return (const unsigned int*)(base + lods[lod].indexOffset);
+        }
+    };
+
+    inline uint64_t align(uint64_t offset)
+    {
+        return (offset + ALIGNMENT - 1) & ~(uint64_t)(ALIGNMENT - 1);
+    }
+
+    // Запись кэша для уже загруженных мешей
+    inline bool write(const std::string& path, uint64_t sourceHash, uint32_t importFlags, const std::vector<Mesh>& meshes)
+    {
+        Header header = {};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.vertexSize = sizeof(Vertex);
+        header.sourceHash = sourceHash;
+        header.importFlags = importFlags;
+        header.meshCount = (uint32_t)meshes.size();
+
+        std::vector<MeshEntry> entries(meshes.size());
+        std::vector<TextureEntry> textures;
+        for (const Mesh& mesh : meshes)
+        {
+            header.textureCount += (uint32_t)mesh.textures.size();
+            header.lodCount += (uint32_t)mesh.lodIndices.size();
+        }
+        std::vector<LodEntry> lods;
+        uint64_t offset = align(sizeof(Header) + sizeof(MeshEntry) * meshes.size() + sizeof(LodEntry) * header.lodCount + sizeof(TextureEntry) * header.textureCount);
+
+        for (size_t i = 0; i < meshes.size(); i++)
+        {
+            const Mesh& mesh = meshes[i];
+            MeshEntry& entry = entries[i];
+            entry.vertexCount = (uint32_t)mesh.vertices.size();
+            entry.indexCount = (uint32_t)mesh.indices.size();
+            entry.vertexOffset = offset;
+            offset = align(offset + sizeof(Vertex) * mesh.vertices.size());
+            entry.indexOffset = offset;
+            offset = align(offset + sizeof(unsigned int) * mesh.indices.size());
+
+            entry.firstLod = (uint32_t)lods.size();
+            entry.lodCount = (uint32_t)mesh.lodIndices.size();
+            for (const std::vector<unsigned int>& lodIndices : mesh.lodIndices)
+            {
+                LodEntry lod = {};
+                lod.indexOffset = offset;
+                lod.indexCount = (uint32_t)lodIndices.size();
+                offset = align(offset + sizeof(unsigned int) * lodIndices.size());
+                lods.push_back(lod);
+            }
+
+            entry.firstTexture = (uint32_t)textures.size();
+            entry.textureCount = (uint32_t)mesh.textures.size();
+            for (const Texture& texture : mesh.textures)
+            {
+                TextureEntry t = {};
+                if (texture.type.size() >= sizeof(t.type) || texture.path.size() >= sizeof(t.path))
+                {
+                    std::cout << "ERROR::MESH_CACHE::TEXTURE_PATH_TOO_LONG " << texture.path << std::endl;
+                    return false;
+                }
+                std::memcpy(t.type, texture.type.c_str(), texture.type.size());
+                std::memcpy(t.path, texture.path.c_str(), texture.path.size());
+                textures.push_back(t);
+            }
+        }
+
+        // Пишем во временный файл и переименовываем, чтобы прерванная запись не оставила битый кэш
+        std::string tempPath = path + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                std::cout << "ERROR::MESH_CACHE::CANNOT_WRITE " << path << std::endl;
+                return false;
+            }
+            auto pad = [&file]() {
+                static const char zeros[ALIGNMENT] = {};
+                uint64_t position = (uint64_t)file.tellp();
+                file.write(zeros, (std::streamsize)(align(position) - position));
+            };
+            file.write((const char*)&header, sizeof(header));
+            file.write((const char*)entries.data(), (std::streamsize)(sizeof(MeshEntry) * entries.size()));
+            file.write((const char*)lods.data(), (std::streamsize)(sizeof(LodEntry) * lods.size()));
+            file.write((const char*)textures.data(), (std::streamsize)(sizeof(TextureEntry) * textures.size()));
+            pad();
+            for (const Mesh& mesh : meshes)
+            {
+                file.write((const char*)mesh.vertices.data(), (std::streamsize)(sizeof(Vertex) * mesh.vertices.size()));
+                pad();
+                file.write((const char*)mesh.indices.data(), (std::streamsize)(sizeof(unsigned int) * mesh.indices.size()));
+                pad();
+                for (const std::vector<unsigned int>& lodIndices : mesh.lodIndices)
+                {
+                    file.write((const char*)lodIndices.data(), (std::streamsize)(sizeof(unsigned int) * lodIndices.size()));
+                    pad();
+                }
+            }
+            if (!file)
+            {
+                std::cout << "ERROR::MESH_CACHE::CANNOT_WRITE " << path << std::endl;
+                return false;
+            }
+        }
+        std::remove(path.c_str());
+        return std::rename(tempPath.c_str(), path.c_str()) == 0;
+    }
+
+    // Проверка отображенного файла и разбор таблицы мешей. false - кэш отсутствует, устарел или поврежден
+    inline bool read(const MappedFile& file, uint64_t sourceHash, uint32_t importFlags, std::vector<BakedMesh>& result)
+    {
+        if (!file.isOpen() || file.size() < sizeof(Header))
+            return false;
+        const Header* header = (const Header*)file.data();
+        if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION ||
+            header->vertexSize != sizeof(Vertex) || header->sourceHash != sourceHash || header->importFlags != importFlags)
+            return false;
+
+        uint64_t tablesEnd = sizeof(Header) + sizeof(MeshEntry) * (uint64_t)header->meshCount + sizeof(LodEntry) * (uint64_t)header->lodCount
+                           + sizeof(TextureEntry) * (uint64_t)header->textureCount;
+        if (tablesEnd > file.size())
+            return false;
+        const MeshEntry* entries = (const MeshEntry*)(file.data() + sizeof(Header));
+        const LodEntry* lods = (const LodEntry*)(entries + header->meshCount);
+        const TextureEntry* textures = (const TextureEntry*)(lods + header->lodCount);
+        for (uint32_t i = 0; i < header->lodCount; i++)
+            if (lods[i].indexOffset + sizeof(unsigned int) * (uint64_t)lods[i].indexCount > file.size())
+                return false;
+        // Строки таблицы материалов читаются как const char*, поэтому в каждом поле должен быть завершающий ноль
+        for (uint32_t i = 0; i < header->textureCount; i++)
+            if (!std::memchr(textures[i].type, 0, sizeof(textures[i].type)) || !std::memchr(textures[i].path, 0, sizeof(textures[i].path)))
+                return false;
+
+        result.clear();
+        result.reserve(header->meshCount);
+        for (uint32_t i = 0; i < header->meshCount; i++)
+        {
+            const MeshEntry& entry = entries[i];
+            if (entry.vertexOffset + sizeof(Vertex) * (uint64_t)entry.vertexCount > file.size() ||
+                entry.indexOffset + sizeof(unsigned int) * (uint64_t)entry.indexCount > file.size() ||
+                (uint64_t)entry.firstTexture + entry.textureCount > header->textureCount ||
+                (uint64_t)entry.firstLod + entry.lodCount > header->lodCount)
+                return false;
+            BakedMesh mesh;
+            mesh.vertices = (const Vertex*)(file.data() + entry.vertexOffset);
+            mesh.vertexCount = entry.vertexCount;
+            mesh.indices = (const unsigned int*)(file.data() + entry.indexOffset);
+            mesh.indexCount = entry.indexCount;
+            mesh.textures = textures + entry.firstTexture;
+            mesh.textureCount = entry.textureCount;
+            mesh.lods = lods + entry.firstLod;
+            mesh.lodCount = entry.lodCount;
+            mesh.base = file.data();
+            result.push_back(mesh);
+        }
+        return true;
+    }
+}
+#endif
@@ -0,0 +1,370 @@
+#ifndef MESH_OPTIMIZER_H
+#define MESH_OPTIMIZER_H
+
+#include "vertex.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+// Оптимизация индексированных мешей после импорта (все функции работают только с массивами CPU
+// и безопасно вызываются из рабочих потоков). Кости вершин (VertexBones), если они есть, лежат в отдельном
+// массиве с теми же номерами и переставляются вместе с вершинами:
+//   1. deduplicate         - слияние побайтно одинаковых вершин (Assimp без JoinIdenticalVertices их не объединяет)
+//   2. optimizeVertexCache - порядок треугольников для кэша преобразованных вершин (алгоритм Тома Форсайта)
+//   3. optimizeOverdraw    - порядок кластеров треугольников "снаружи внутрь", чтобы меньше пикселей перекрывалось
+//   4. optimizeVertexFetch - порядок вершин по первому использованию, чтобы выборка вершин шла по памяти подряд
+// analyzeVertexCache оценивает результат: ACMR (промахов кэша на треугольник) и ATVR (преобразований на вершину)
+namespace MeshOptimizer
+{
+    struct CacheStatistics {
+        unsigned long long triangles = 0;
+        unsigned long long vertices = 0;    // вершин, на которые ссылаются индексы
+        unsigned long long transformed = 0; // промахов кэша (запусков вершинного шейдера)
+
+        float acmr() const { return triangles ? (float)transformed / (float)triangles : 0.0f; }
+        float atvr() const { return vertices ? (float)transformed / (float)vertices : 0.0f; }
+
+        CacheStatistics& operator+=(const CacheStatistics& s)
+        {
+            triangles += s.triangles;
+            vertices += s.vertices;
+            transformed += s.transformed;
+            return *this;
+        }
+    };
+
+    // Моделирование FIFO-кэша преобразованных вершин размером cacheSize
+    inline CacheStatistics analyzeVertexCache(const unsigned int* indices, size_t indexCount, size_t vertexCount, unsigned int cacheSize = 16)
+    {
+        CacheStatistics result;
+        result.triangles = indexCount / 3;
+        // Время попадания вершины в кэш: вершина в кэше, если с тех пор промахов было меньше cacheSize
+        std::vector<unsigned long long> insertedAt(vertexCount, 0);
+        std::vector<unsigned char> used(vertexCount, 0);
+        unsigned long long time = 0;
+        for (size_t i = 0; i < indexCount; i++)
+        {
+            unsigned int v = indices[i];
+            if (!used[v])
+            {
+                used[v] = 1;
+                result.vertices++;
+            }
+            if (insertedAt[v] == 0 || time + 1 - insertedAt[v] > cacheSize)
+            {
+                insertedAt[v] = ++time;
+                result.transformed++;
+            }
+        }
+        return result;
+    }
+
+    // Побайтные хэш и сравнение вершин (Vertex или SkinnedVertex: в обеих структурах нет выравнивающих байтов)
+    struct VertexHash {
+        template <typename T>
+        size_t operator()(const T& v) const
+        {
+            const uint32_t* words = (const uint32_t*)&v;
+            uint32_t hash = 2166136261u;
+            for (size_t i = 0; i < sizeof(T) / sizeof(uint32_t); i++)
+                hash = (hash ^ words[i]) * 16777619u;
+            return hash;
+        }
+    };
+
+    struct VertexEqual {
+        template <typename T>
+        bool operator()(const T& a, const T& b) const
+        {
+            return std::memcmp(&a, &b, sizeof(T)) == 0;
+        }
+    };
+
+    // Вершина вместе с костями: ключ слияния, чтобы не объединить вершины с разными весами
+    struct SkinnedVertex {
+        Vertex vertex;
+        VertexBones bones;
+    };
+
+    // Слияние вершин с одинаковыми атрибутами (и костями, если bones не пуст). Индексы переписываются на оставшиеся вершины
+    inline void deduplicate(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, std::vector<VertexBones>& bones)
+    {
+        bool skinned = !bones.empty();
+        std::unordered_map<SkinnedVertex, unsigned int, VertexHash, VertexEqual> unique;
+        unique.reserve(vertices.size());
+        std::vector<unsigned int> remap(vertices.size());
+        size_t write = 0;
+        for (size_t i = 0; i < vertices.size(); i++)
+        {
+            SkinnedVertex key = { vertices[i], skinned ? bones[i] : VertexBones() };
+            auto inserted = unique.insert(std::make_pair(key, (unsigned int)write));
+            if (inserted.second)
+            {
+                vertices[write] = vertices[i];
+                if (skinned)
+                    bones[write] = bones[i];
+                write++;
+            }
+            remap[i] = inserted.first->second;
+        }
+        vertices.resize(write);
+        if (skinned)
+            bones.resize(write);
+        for (unsigned int& index : indices)
+            index = remap[index];
+    }
+
+    // Переупорядочивание треугольников для кэша вершин (T. Forsyth, "Linear-Speed Vertex Cache Optimisation").
+    // Каждой вершине назначается вес: выше у вершин, недавно попавших в моделируемый LRU-кэш, и у вершин,
+    // у которых осталось мало невыведенных треугольников. Следующим выводится треугольник с наибольшей суммой весов
+    inline void optimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount)
+    {
+        const int CACHE_SIZE = 32;
+        const float CACHE_DECAY_POWER = 1.5f;
+        const float LAST_TRIANGLE_SCORE = 0.75f;
+        const float VALENCE_BOOST_SCALE = 2.0f;
+        const float VALENCE_BOOST_POWER = 0.5f;
+
+        size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2)
+            return;
+
+        // Треугольники при каждой вершине
+        std::vector<unsigned int> offsets(vertexCount + 1, 0), remaining(vertexCount, 0);
+        for (unsigned int index : indices)
+            remaining[index]++;
+        for (size_t v = 0; v < vertexCount; v++)
+            offsets[v + 1] = offsets[v] + remaining[v];
+        std::vector<unsigned int> adjacency(indices.size());
+        {
+            std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t t = 0; t < triangleCount; t++)
+                for (int k = 0; k < 3; k++)
+                    adjacency[fill[indices[t * 3 + k]]++] = (unsigned int)t;
+        }
+
+        auto vertexScore = [&](int cachePosition, unsigned int valence) {
+            if (valence == 0)
+                return -1.0f; // треугольников не осталось, вершина больше не нужна
+            float score = 0.0f;
+            if (cachePosition >= 0)
+            {
+                if (cachePosition < 3)
+                    score = LAST_TRIANGLE_SCORE; // вершины последнего треугольника: одинаковый вес независимо от порядка
+                else
+                    score = std::pow(1.0f - (float)(cachePosition - 3) / (float)(CACHE_SIZE - 3), CACHE_DECAY_POWER);
+            }
+            return score + VALENCE_BOOST_SCALE * std::pow((float)valence, -VALENCE_BOOST_POWER);
+        };
+
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScores(vertexCount);
+        for (size_t v = 0; v < vertexCount; v++)
+            vertexScores[v] = vertexScore(-1, remaining[v]);
+        std::vector<float> triangleScores(triangleCount);
+        for (size_t t = 0; t < triangleCount; t++)
+            triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+
+        std::vector<unsigned char> emitted(triangleCount, 0);
+        std::vector<unsigned int> result;
+        result.reserve(indices.size());
+        std::vector<unsigned int> cache, newCache;
+        cache.reserve(CACHE_SIZE + 3);
+        newCache.reserve(CACHE_SIZE + 3);
+
+        size_t nextUnemitted = 0;
+        long long best = -1;
+        for (size_t output = 0; output < triangleCount; output++)
+        {
+            // Кэш не дал кандидатов: берем первый невыведенный треугольник
+            if (best < 0)
+            {
+                while (emitted[nextUnemitted])
+                    nextUnemitted++;
+                best = (long long)nextUnemitted;
+            }
+            const unsigned int* tri = &indices[(size_t)best * 3];
+            emitted[best] = 1;
+            result.insert(result.end(), tri, tri + 3);
+
+            // Вершины треугольника в начало кэша, остальные сдвигаются
+            newCache.assign(tri, tri + 3);
+            for (unsigned int v : cache)
+                if (v != tri[0] && v != tri[1] && v != tri[2])
+                    newCache.push_back(v);
+            for (int k = 0; k < 3; k++)
+            {
+                unsigned int v = tri[k];
+                remaining[v]--;
+                // Выведенный треугольник убираем из списка смежности вершины
+                unsigned int* first = &adjacency[offsets[v]];
+                unsigned int* last = first + remaining[v] + 1;
+                *std::find(first, last, (unsigned int)best) = *(last - 1);
+            }
+
+            // Пересчитываем веса вершин кэша (и вытесненных из него) и их треугольников
+            for (size_t i = 0; i < newCache.size(); i++)
+            {
+                unsigned int v = newCache[i];
+                cachePosition[v] = i < (size_t)CACHE_SIZE ? (int)i : -1;
+                float score = vertexScore(cachePosition[v], remaining[v]);
+                float delta = score - vertexScores[v];
+                vertexScores[v] = score;
+                for (unsigned int j = offsets[v]; j < offsets[v] + remaining[v]; j++)
+                    triangleScores[adjacency[j]] += delta;
+            }
+            if (newCache.size() > (size_t)CACHE_SIZE)
+                newCache.resize(CACHE_SIZE);
+            cache.swap(newCache);
+
+            // Лучший кандидат среди треугольников вершин кэша
+            best = -1;
+            float bestScore = 0.0f;
+            for (unsigned int v : cache)
+            {
+                for (unsigned int j = offsets[v]; j < offsets[v] + remaining[v]; j++)
+                {
+                    unsigned int t = adjacency[j];
+                    if (best < 0 || triangleScores[t] > bestScore)
+                    {
+                        best = t;
+                        bestScore = triangleScores[t];
+                    }
+                }
+            }
+        }
+        indices.swap(result);
+    }
+
+    // Упорядочивание против перерисовки (по мотивам Sander et al., "Fast Triangle Reordering for Vertex Locality
+    // and Reduced Overdraw"). Уже оптимизированный для кэша список режется на кластеры там, где кэш начинается
+    // почти заново (у треугольника не меньше двух промахов), если это ухудшает ACMR кластера не более чем в threshold раз.
+    // Кластеры сортируются по тому, насколько они обращены наружу от центра меша: внешние поверхности рисуются
+    // первыми и закрывают внутренние при проверке глубины
+    inline void optimizeOverdraw(const std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, float threshold = 1.05f, unsigned int cacheSize = 16)
+    {
+        const size_t MIN_CLUSTER_TRIANGLES = 16;
+        size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2)
+            return;
+
+        // Границы кластеров
+        std::vector<size_t> clusters; // первый треугольник каждого кластера
+        {
+            float meshAcmr = analyzeVertexCache(indices.data(), indices.size(), vertices.size(), cacheSize).acmr();
+            std::vector<unsigned long long> insertedAt(vertices.size(), 0);
+            unsigned long long time = 0, clusterMisses = 0;
+            size_t clusterStart = 0;
+            for (size_t t = 0; t < triangleCount; t++)
+            {
+                unsigned int misses = 0;
+                for (int k = 0; k < 3; k++)
+                {
+                    unsigned int v = indices[t * 3 + k];
+                    if (insertedAt[v] == 0 || time + 1 - insertedAt[v] > cacheSize)
+                    {
+                        insertedAt[v] = ++time;
+                        misses++;
+                    }
+                }
+                size_t clusterTriangles = t - clusterStart;
+                if (t == 0 || (misses >= 2 && clusterTriangles >= MIN_CLUSTER_TRIANGLES && (float)clusterMisses / (float)clusterTriangles <= meshAcmr * threshold))
+                {
+                    clusters.push_back(t);
+                    clusterStart = t;
+                    clusterMisses = 0;
+                }
+                clusterMisses += misses;
+            }
+        }
+        if (clusters.size() < 2)
+            return;
+
+        // Центр меша: среднее центров треугольников с весом площади
+        glm::dvec3 meshCenter(0.0);
+        double meshArea = 0.0;
+        for (size_t t = 0; t < triangleCount; t++)
+        {
+            glm::dvec3 p0 = vertices[indices[t * 3]].Position, p1 = vertices[indices[t * 3 + 1]].Position, p2 = vertices[indices[t * 3 + 2]].Position;
+            double area = glm::length(glm::cross(p1 - p0, p2 - p0));
+            meshCenter += (p0 + p1 + p2) * (area / 3.0);
+            meshArea += area;
+        }
+        if (meshArea > 0.0)
+            meshCenter /= meshArea;
+
+        // Для кластера: скалярное произведение (центр кластера - центр меша) на среднюю нормаль кластера
+        struct Cluster {
+            size_t first, count;
+            double sortKey;
+        };
+        std::vector<Cluster> order(clusters.size());
+        for (size_t c = 0; c < clusters.size(); c++)
+        {
+            size_t first = clusters[c], last = c + 1 < clusters.size() ? clusters[c + 1] : triangleCount;
+            glm::dvec3 center(0.0), normal(0.0);
+            double area = 0.0;
+            for (size_t t = first; t < last; t++)
+            {
+                glm::dvec3 p0 = vertices[indices[t * 3]].Position, p1 = vertices[indices[t * 3 + 1]].Position, p2 = vertices[indices[t * 3 + 2]].Position;
+                glm::dvec3 n = glm::cross(p1 - p0, p2 - p0);
+                double a = glm::length(n);
+                center += (p0 + p1 + p2) * (a / 3.0);
+                normal += n;
+                area += a;
+            }
+            double length = glm::length(normal);
+            double key = 0.0;
+            if (area > 0.0 && length > 0.0)
+                key = glm::dot(center / area - meshCenter, normal / length);
+            order[c] = { first, last - first, key };
+        }
+        std::stable_sort(order.begin(), order.end(), [](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+        std::vector<unsigned int> result;
+        result.reserve(indices.size());
+        for (const Cluster& cluster : order)
+            result.insert(result.end(), indices.begin() + cluster.first * 3, indices.begin() + (cluster.first + cluster.count) * 3);
+        indices.swap(result);
+    }
+
+    // Перестановка вершин в порядке первого использования индексами; вершины без ссылок удаляются
+    inline void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, std::vector<VertexBones>& bones)
+    {
+        const unsigned int UNUSED = ~0u;
+        std::vector<unsigned int> remap(vertices.size(), UNUSED);
+        std::vector<Vertex> result;
+        std::vector<VertexBones> resultBones;
+        result.reserve(vertices.size());
+        resultBones.reserve(bones.size());
+        for (unsigned int& index : indices)
+        {
+            if (remap[index] == UNUSED)
+            {
+                remap[index] = (unsigned int)result.size();
+                result.push_back(vertices[index]);
+                if (!bones.empty())
+                    resultBones.push_back(bones[index]);
+            }
+            index = remap[index];
+        }
+        vertices.swap(result);
+        bones.swap(resultBones);
+    }
+
+    // Полный конвейер для меша, только что полученного из импортера (bones пуст у меша без костей)
+    inline void optimize(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, std::vector<VertexBones>& bones)
+    {
+        deduplicate(vertices, indices, bones);
+        optimizeVertexCache(indices, vertices.size());
+        optimizeOverdraw(vertices, indices);
+        optimizeVertexFetch(vertices, indices, bones);
+    }
+}
+#endif
@@ -0,0 +1,566 @@
+#ifndef MIPMAP_H
+#define MIPMAP_H
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// SSE2 есть на любом x86-64; ядра AVX2 компилируются отдельно (атрибут target) и выбираются во время работы
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define MIPMAP_SSE2 1
+#if defined(__GNUC__) || defined(__clang__)
+#define MIPMAP_AVX2 1
+#define MIPMAP_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(__AVX2__)
+#define MIPMAP_AVX2 1
+#define MIPMAP_TARGET_AVX2
+#endif
+#endif
+
+// Построение цепочки мип-уровней на CPU: для загрузки текстур (вместо glGenerateMipmap, который медленный
+// на программных растеризаторах вроде llvmpipe и фильтрует по-разному у разных драйверов) и для запекания.
+// Уровень строится из предыдущего разделимым фильтром (сначала по строкам, затем по столбцам) в линейных
+// float RGBA; промежуточные уровни хранятся в float, чтобы ошибки округления не накапливались по цепочке.
+// Полосы строк фильтруются параллельно в пуле потоков, внутренние циклы - на SSE2/AVX2
+namespace Mipmap
+{
+    struct Level {
+        int width, height;
+        std::vector<unsigned char> pixels; // RGBA8
+    };
+
+    enum Filter {
+        Box,    // среднее блока 2x2 (по нечетной стороне - многофазный ящик из 3 отсчетов): быстро, но мелкие детали дают муар
+        Kaiser, // sinc с окном Кайзера по 8 отсчетам: четче и без муара, возможен легкий ореол
+    };
+
+    struct Options {
+        Filter filter = Box;
+        bool srgb = false;             // RGB в sRGB: фильтрация в линейном пространстве (альфа всегда линейная)
+        bool preserveCoverage = false; // сохранять долю пикселей с альфой не ниже alphaCutoff (вырезанные текстуры)
+        float alphaCutoff = 0.5f;
+    };
+
+    enum Simd {
+        Scalar,
+        Sse2,
+        Avx2,
+    };
+
+    // Набор инструкций ядер; определяется при первом вызове, его можно понизить для сравнения
+    inline Simd& simd()
+    {
+        static Simd level = []() {
+#if defined(MIPMAP_AVX2) && (defined(__GNUC__) || defined(__clang__))
+            if (__builtin_cpu_supports("avx2"))
+                return Avx2;
+#elif defined(MIPMAP_AVX2)
+            return Avx2;
+#endif
+#ifdef MIPMAP_SSE2
+            return Sse2;
+#else
+            return Scalar;
+#endif
+        }();
+        return level;
+    }
+
+    // Изображение с плотными RGBA-пикселями во float (линейные значения 0..1)
+    struct FloatLevel {
+        int width = 0, height = 0;
+        std::vector<float> pixels;
+    };
+
+    // Веса фильтра уменьшения вдвое: отсчет x результата = sum weights[k] * src[2x + first + k].
+    // У многофазного фильтра (phases > 0) веса зависят от x и берутся из phase(x)
+    struct Kernel {
+        static const int MAX_TAPS = 8;
+        int first = 0;
+        int taps = 0;
+        int phases = 0; // n для ящика по нечетной стороне из 2n+1 отсчетов, иначе 0
+        float weights[MAX_TAPS];
+
+        // Веса пикселя x многофазного ящика: каждый из 2n+1 отсчетов попадает в результат с одним и тем же
+        // суммарным весом n/(2n+1), т.е. n пикселей результата - точное среднее по площади
+        Kernel phase(int x) const
+        {
+            Kernel kernel = *this;
+            float scale = 1.0f / (2 * phases + 1);
+            kernel.weights[0] = (phases - x) * scale;
+            kernel.weights[1] = phases * scale;
+            kernel.weights[2] = (x + 1) * scale;
+            return kernel;
+        }
+    };
+
+    // Фильтр для стороны длиной srcSize. Среднее пары отсчетов на нечетной стороне не доставало бы последней строки
+    // (столбца): у 2n+1 отсчетов результат из n пикселей покрывал бы только первые 2n. Поэтому там пиксель x
+    // собирается из трех отсчетов 2x, 2x+1, 2x+2 с весами (n-x)/(2n+1), n/(2n+1), (x+1)/(2n+1): пиксель
+    // накрывает (2n+1)/n отсчетов источника, и крайние отсчеты весят столько же, сколько внутренние
+    inline Kernel makeKernel(Filter filter, int srcSize)
+    {
+        Kernel kernel;
+        if (filter == Box && srcSize > 1 && srcSize % 2 == 1)
+        {
+            kernel.first = 0;
+            kernel.taps = 3;
+            kernel.phases = srcSize / 2;
+            return kernel.phase(0);
+        }
+        if (filter == Box)
+        {
+            kernel.first = 0;
+            kernel.taps = 2;
+            kernel.weights[0] = kernel.weights[1] = 0.5f;
+            return kernel;
+        }
+        // Функция Бесселя I0 для окна Кайзера (ряд сходится за десяток членов)
+        auto besselI0 = [](double x) {
+            double sum = 1.0, term = 1.0;
+            for (int k = 1; k < 20; k++)
+            {
+                term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                sum += term;
+            }
+            return sum;
+        };
+        const double PI = 3.14159265358979323846, ALPHA = 4.0, RADIUS = 4.0;
+        kernel.first = -3;
+        kernel.taps = 8;
+        double total = 0.0, weights[Kernel::MAX_TAPS];
+        for (int k = 0; k < kernel.taps; k++)
+        {
+            // Расстояние от центра пары пикселей 2x, 2x+1 в пикселях исходного уровня
+            double d = kernel.first + k - 0.5;
+            double sinc = std::sin(PI * d / 2.0) / (PI * d / 2.0);
+            double ratio = d / RADIUS;
+            double window = besselI0(ALPHA * std::sqrt(std::max(0.0, 1.0 - ratio * ratio))) / besselI0(ALPHA);
+            weights[k] = sinc * window;
+            total += weights[k];
+        }
+        for (int k = 0; k < kernel.taps; k++)
+            kernel.weights[k] = (float)(weights[k] / total);
+        return kernel;
+    }
+
+    // sRGB (8 бит) -> линейное значение
+    inline const float* srgbToLinearTable()
+    {
+        static const std::vector<float> table = []() {
+            std::vector<float> values(256);
+            for (int i = 0; i < 256; i++)
+            {
+                double c = i / 255.0;
+                values[i] = (float)(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+            }
+            return values;
+        }();
+        return table.data();
+    }
+
+    // Линейное значение 0..1 -> sRGB (8 бит) с точным округлением. thresholds - границы между соседними кодами
+    // в линейном пространстве; таблица по 4096 интервалам дает код начала интервала, от которого
+    // до нужного кода остается не больше нескольких шагов
+    inline unsigned char linearToSrgb(float value)
+    {
+        struct Tables {
+            std::vector<float> thresholds;
+            std::vector<unsigned char> start;
+        };
+        static const Tables tables = []() {
+            Tables t;
+            t.thresholds.resize(256, 2.0f); // последняя граница недостижима
+            for (int i = 0; i < 255; i++)
+            {
+                double c = (i + 0.5) / 255.0;
+                t.thresholds[i] = (float)(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+            }
+            t.start.resize(4097);
+            for (int i = 0; i <= 4096; i++)
+                t.start[i] = (unsigned char)(std::upper_bound(t.thresholds.begin(), t.thresholds.end(), i / 4096.0f) - t.thresholds.begin());
+            return t;
+        }();
+        int code = tables.start[(int)(value * 4096.0f)];
+        while (value >= tables.thresholds[code])
+            code++;
+        return (unsigned char)code;
+    }
+
+    // Строка RGBA8 (count значений) во float 0..1; RGB из sRGB переводятся в линейные
+    inline void unpackRow(const unsigned char* src, float* dst, size_t count, bool srgb)
+    {
+        size_t i = 0;
+        if (srgb)
+        {
+            const float* toLinear = srgbToLinearTable();
+            for (; i < count; i += 4)
+            {
+                dst[i] = toLinear[src[i]];
+                dst[i + 1] = toLinear[src[i + 1]];
+                dst[i + 2] = toLinear[src[i + 2]];
+                dst[i + 3] = src[i + 3] * (1.0f / 255.0f);
+            }
+            return;
+        }
+#ifdef MIPMAP_SSE2
+        if (simd() >= Sse2)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+            for (; i + 16 <= count; i += 16)
+            {
+                __m128i bytes = _mm_loadu_si128((const __m128i*)(src + i));
+                __m128i low = _mm_unpacklo_epi8(bytes, zero), high = _mm_unpackhi_epi8(bytes, zero);
+                _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale));
+                _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale));
+                _mm_storeu_ps(dst + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale));
+                _mm_storeu_ps(dst + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale));
+            }
+        }
+#endif
+        for (; i < count; i++)
+            dst[i] = src[i] * (1.0f / 255.0f);
+    }
+
+    // Строки и столбцы за краем изображения повторяют крайние
+    inline int clampIndex(int i, int size) { return std::min(std::max(i, 0), size - 1); }
+
+#ifdef MIPMAP_AVX2
+    // Два пикселя результата за итерацию: отсчеты пикселей x и x+1 отстоят на 2 пикселя источника
+    MIPMAP_TARGET_AVX2 inline int filterRowAvx2(const float* src, const Kernel& kernel, float* dst, int begin, int end)
+    {
+        __m256 weights[Kernel::MAX_TAPS];
+        for (int k = 0; k < kernel.taps; k++)
+            weights[k] = _mm256_set1_ps(kernel.weights[k]);
+        int x = begin;
+        for (; x + 2 <= end; x += 2)
+        {
+            const float* first = src + (size_t)(2 * x + kernel.first) * 4;
+            __m256 sum = _mm256_setzero_ps();
+            for (int k = 0; k < kernel.taps; k++)
+            {
+                __m256 pair = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(first + k * 4)), _mm_loadu_ps(first + k * 4 + 8), 1);
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(weights[k], pair));
+            }
+            _mm256_storeu_ps(dst + (size_t)x * 4, sum);
+        }
+        return x;
+    }
+
+    MIPMAP_TARGET_AVX2 inline size_t filterColumnsAvx2(const float* const* rows, const Kernel& kernel, float* dst, size_t count)
+    {
+        const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 sum = _mm256_setzero_ps();
+            for (int k = 0; k < kernel.taps; k++)
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(kernel.weights[k]), _mm256_loadu_ps(rows[k] + i)));
+            _mm256_storeu_ps(dst + i, _mm256_min_ps(_mm256_max_ps(sum, zero), one));
+        }
+        return i;
+    }
+#endif
+
+    // Горизонтальный проход многофазным ящиком: все три отсчета каждого пикселя внутри строки (srcWidth = 2 * dstWidth + 1)
+    inline void filterRowPhases(const float* src, const Kernel& kernel, float* dst, int dstWidth)
+    {
+        for (int x = 0; x < dstWidth; x++)
+        {
+            const Kernel weights = kernel.phase(x);
+            const float* first = src + (size_t)(2 * x) * 4;
+#ifdef MIPMAP_SSE2
+            if (simd() >= Sse2)
+            {
+                __m128 sum = _mm_mul_ps(_mm_set1_ps(weights.weights[0]), _mm_loadu_ps(first));
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights.weights[1]), _mm_loadu_ps(first + 4)));
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights.weights[2]), _mm_loadu_ps(first + 8)));
+                _mm_storeu_ps(dst + (size_t)x * 4, sum);
+                continue;
+            }
+#endif
+            for (int c = 0; c < 4; c++)
+                dst[(size_t)x * 4 + c] = weights.weights[0] * first[c] + weights.weights[1] * first[c + 4] + weights.weights[2] * first[c + 8];
+        }
+    }
+
+    // Горизонтальный проход: строка src шириной srcWidth -> dstWidth пикселей
+    inline void filterRow(const float* src, int srcWidth, const Kernel& kernel, float* dst, int dstWidth)
+    {
+        if (kernel.phases)
+        {
+            filterRowPhases(src, kernel, dst, dstWidth);
+            return;
+        }
+        // Пиксели, все отсчеты которых внутри строки, считаются без проверки границ
+        int interiorBegin = std::min(dstWidth, std::max(0, (-kernel.first + 1) / 2));
+        int span = srcWidth - kernel.taps - kernel.first;
+        int interiorEnd = std::max(interiorBegin, std::min(dstWidth, span < 0 ? 0 : span / 2 + 1));
+        int x = 0;
+        auto edgePixel = [&](int x) {
+            float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            for (int k = 0; k < kernel.taps; k++)
+            {
+                const float* pixel = src + (size_t)clampIndex(2 * x + kernel.first + k, srcWidth) * 4;
+                for (int c = 0; c < 4; c++)
+                    sum[c] += kernel.weights[k] * pixel[c];
+            }
+            std::copy(sum, sum + 4, dst + (size_t)x * 4);
+        };
+        for (; x < interiorBegin; x++)
+            edgePixel(x);
+#ifdef MIPMAP_AVX2
+        if (simd() >= Avx2)
+            x = filterRowAvx2(src, kernel, dst, x, interiorEnd);
+#endif
+#ifdef MIPMAP_SSE2
+        if (simd() >= Sse2)
+        {
+            __m128 weights[Kernel::MAX_TAPS];
+            for (int k = 0; k < kernel.taps; k++)
+                weights[k] = _mm_set1_ps(kernel.weights[k]);
+            for (; x < interiorEnd; x++)
+            {
+                const float* first = src + (size_t)(2 * x + kernel.first) * 4;
+                __m128 sum = _mm_mul_ps(weights[0], _mm_loadu_ps(first));
+                for (int k = 1; k < kernel.taps; k++)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(weights[k], _mm_loadu_ps(first + k * 4)));
+                _mm_storeu_ps(dst + (size_t)x * 4, sum);
+            }
+        }
+#endif
+        for (; x < dstWidth; x++)
+            edgePixel(x);
+    }
+
+    // Вертикальный проход: count значений строки результата из kernel.taps отфильтрованных строк;
+    // результат ограничивается 0..1 (отрицательные лепестки фильтра Кайзера дают выбросы)
+    inline void filterColumns(const float* const* rows, const Kernel& kernel, float* dst, size_t count)
+    {
+        size_t i = 0;
+#ifdef MIPMAP_AVX2
+        if (simd() >= Avx2)
+            i = filterColumnsAvx2(rows, kernel, dst, count);
+#endif
+#ifdef MIPMAP_SSE2
+        if (simd() >= Sse2)
+        {
+            const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 sum = _mm_setzero_ps();
+                for (int k = 0; k < kernel.taps; k++)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(kernel.weights[k]), _mm_loadu_ps(rows[k] + i)));
+                _mm_storeu_ps(dst + i, _mm_min_ps(_mm_max_ps(sum, zero), one));
+            }
+        }
+#endif
+        for (; i < count; i++)
+        {
+            float sum = 0.0f;
+            for (int k = 0; k < kernel.taps; k++)
+                sum += kernel.weights[k] * rows[k][i];
+            dst[i] = std::min(std::max(sum, 0.0f), 1.0f);
+        }
+    }
+
+    // Уровень вдвое меньше (нечетные размеры округляются вниз, фильтр по каждой стороне - makeKernel(filter, длина)).
+    // row(y, scratch) возвращает строку y источника во float RGBA - готовую или преобразованную в scratch.
+    // Выходные строки делятся на полосы по BAND_ROWS; каждая полоса в пуле потоков фильтрует по горизонтали
+    // нужные ей строки источника (с перекрытием на краях соседних полос) и затем по вертикали
+    template <typename RowSource>
+    FloatLevel reduce(const RowSource& row, int srcWidth, int srcHeight, Filter filter)
+    {
+        const int BAND_ROWS = 16;
+        const Kernel horizontal = makeKernel(filter, srcWidth), vertical = makeKernel(filter, srcHeight);
+        FloatLevel result;
+        result.width = std::max(1, srcWidth / 2);
+        result.height = std::max(1, srcHeight / 2);
+        result.pixels.resize((size_t)result.width * result.height * 4);
+        size_t rowFloats = (size_t)result.width * 4;
+        size_t bands = (result.height + BAND_ROWS - 1) / BAND_ROWS;
+        workerPool().parallelFor(bands, [&](size_t band) {
+            int y0 = (int)band * BAND_ROWS, y1 = std::min(result.height, y0 + BAND_ROWS);
+            int firstRow = 2 * y0 + vertical.first, lastRow = 2 * (y1 - 1) + vertical.first + vertical.taps - 1;
+            std::vector<float> filtered((size_t)(lastRow - firstRow + 1) * rowFloats);
+            std::vector<float> scratch((size_t)srcWidth * 4);
+            for (int r = firstRow; r <= lastRow; r++)
+                filterRow(row(clampIndex(r, srcHeight), scratch.data()), srcWidth, horizontal, &filtered[(size_t)(r - firstRow) * rowFloats], result.width);
+            const float* rows[Kernel::MAX_TAPS];
+            for (int y = y0; y < y1; y++)
+            {
+                for (int k = 0; k < vertical.taps; k++)
+                    rows[k] = &filtered[(size_t)(2 * y + vertical.first + k - firstRow) * rowFloats];
+                filterColumns(rows, vertical.phases ? vertical.phase(y) : vertical, &result.pixels[(size_t)y * rowFloats], rowFloats);
+            }
+        });
+        return result;
+    }
+
+    // Доля пикселей 8-битного изображения с альфой не ниже cutoff
+    inline float coverage(const Level& level, float cutoff)
+    {
+        int threshold = (int)std::ceil(cutoff * 255.0f);
+        size_t covered = 0, count = (size_t)level.width * level.height;
+        for (size_t i = 0; i < count; i++)
+            covered += level.pixels[i * 4 + 3] >= threshold;
+        return count ? (float)covered / count : 0.0f;
+    }
+
+    // Множитель альфы, при котором доля пикселей уровня с альфой не ниже cutoff равна target
+    // (по гистограмме альфы: порог, выше которого лежит нужная доля, переводится в cutoff)
+    inline float coverageScale(const FloatLevel& level, float cutoff, float target)
+    {
+        const int BINS = 1024;
+        std::vector<size_t> histogram(BINS);
+        size_t count = (size_t)level.width * level.height;
+        for (size_t i = 0; i < count; i++)
+            histogram[std::min(BINS - 1, (int)(level.pixels[i * 4 + 3] * BINS))]++;
+        size_t wanted = (size_t)std::lround(target * count), covered = 0;
+        int bin = BINS - 1;
+        for (; bin > 0; bin--)
+        {
+            covered += histogram[bin];
+            if (covered >= wanted)
+                break;
+        }
+        return bin > 0 ? cutoff / ((float)bin / BINS) : 1.0f;
+    }
+
+    // Перевод уровня в RGBA8; альфа умножается на alphaScale
+    inline Level quantize(const FloatLevel& level, const Options& options, float alphaScale = 1.0f)
+    {
+        Level result;
+        result.width = level.width;
+        result.height = level.height;
+        result.pixels.resize((size_t)level.width * level.height * 4);
+        workerPool().parallelFor((size_t)level.height, [&](size_t y) {
+            size_t i = y * level.width * 4, end = i + (size_t)level.width * 4;
+            const float* source = level.pixels.data();
+            unsigned char* target = result.pixels.data();
+            if (options.srgb)
+            {
+                for (; i < end; i += 4)
+                {
+                    for (int c = 0; c < 3; c++)
+                        target[i + c] = linearToSrgb(source[i + c]);
+                    target[i + 3] = (unsigned char)(std::min(source[i + 3] * alphaScale, 1.0f) * 255.0f + 0.5f);
+                }
+                return;
+            }
+#ifdef MIPMAP_SSE2
+            if (simd() >= Sse2)
+            {
+                // Четыре пикселя за итерацию: масштаб с alphaScale в канале альфы, округление, упаковка в байты
+                const __m128 scale = _mm_setr_ps(255.0f, 255.0f, 255.0f, 255.0f * alphaScale);
+                const __m128 half = _mm_set1_ps(0.5f), limit = _mm_set1_ps(255.0f);
+                auto convert = [&](size_t at) {
+                    return _mm_cvttps_epi32(_mm_min_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(source + at), scale), half), limit));
+                };
+                for (; i + 16 <= end; i += 16)
+                {
+                    __m128i low = _mm_packs_epi32(convert(i), convert(i + 4));
+                    __m128i high = _mm_packs_epi32(convert(i + 8), convert(i + 12));
+                    _mm_storeu_si128((__m128i*)(target + i), _mm_packus_epi16(low, high));
+                }
+            }
+#endif
+            for (; i < end; i += 4)
+            {
+                for (int c = 0; c < 3; c++)
+                    target[i + c] = (unsigned char)(source[i + c] * 255.0f + 0.5f);
+                target[i + 3] = (unsigned char)(std::min(source[i + 3] * alphaScale, 1.0f) * 255.0f + 0.5f);
+            }
+        });
+        return result;
+    }
+
+    // Полная цепочка до 1x1; levels[0] - исходное изображение
+    inline std::vector<Level> generateChain(Level base, const Options& options = Options())
+    {
+        float targetCoverage = options.preserveCoverage ? coverage(base, options.alphaCutoff) : 0.0f;
+
+        std::vector<Level> levels;
+        levels.push_back(std::move(base));
+        if (levels[0].width == 1 && levels[0].height == 1)
+            return levels;
+        // Первый уровень строится прямо из 8-битных строк, дальше - из float-уровня
+        const Level& source = levels[0];
+        FloatLevel current = reduce([&](int y, float* scratch) {
+            unpackRow(&source.pixels[(size_t)y * source.width * 4], scratch, (size_t)source.width * 4, options.srgb);
+            return (const float*)scratch;
+        }, source.width, source.height, options.filter);
+        while (true)
+        {
+            float scale = options.preserveCoverage ? coverageScale(current, options.alphaCutoff, targetCoverage) : 1.0f;
+            levels.push_back(quantize(current, options, scale));
+            if (current.width == 1 && current.height == 1)
+                break;
+            FloatLevel next = reduce([&](int y, float*) {
+                return &current.pixels[(size_t)y * current.width * 4];
+            }, current.width, current.height, options.filter);
+            current = std::move(next);
+        }
+        return levels;
+    }
+
+    inline std::vector<Level> generateChain(const unsigned char* rgba, int width, int height, const Options& options = Options())
+    {
+        Level base;
+        base.width = width;
+        base.height = height;
+        base.pixels.assign(rgba, rgba + (size_t)width * height * 4);
+        return generateChain(std::move(base), options);
+    }
+
+    // Следующий уровень (одно уменьшение вдвое)
+    inline Level downsample(const Level& source, const Options& options = Options())
+    {
+        FloatLevel reduced = reduce([&](int y, float* scratch) {
+            unpackRow(&source.pixels[(size_t)y * source.width * 4], scratch, (size_t)source.width * 4, options.srgb);
+            return (const float*)scratch;
+        }, source.width, source.height, options.filter);
+        float scale = options.preserveCoverage ? coverageScale(reduced, options.alphaCutoff, coverage(source, options.alphaCutoff)) : 1.0f;
+        return quantize(reduced, options, scale);
+    }
+
+    // Изображение с components каналами (1-4) в RGBA8 без изменения смысла каналов: недостающие цветовые
+    // каналы нулевые, недостающая альфа - 255 (при загрузке в GL_R8/GL_RG8/GL_RGB8 лишние каналы отбрасываются)
+    inline Level expand(const unsigned char* pixels, int width, int height, int components)
+    {
+        Level level;
+        level.width = width;
+        level.height = height;
+        level.pixels.assign((size_t)width * height * 4, 0);
+        for (size_t i = 0; i < (size_t)width * height; i++)
+        {
+            for (int c = 0; c < components; c++)
+                level.pixels[i * 4 + c] = pixels[i * components + c];
+            if (components < 4)
+                level.pixels[i * 4 + 3] = 255;
+        }
+        return level;
+    }
+
+    // Вырезанная текстура (листва, решетки, перекрестие): альфа почти везде 0 или 255 и есть прозрачные
+    // пиксели. Для таких текстур альфа-тест на дальних уровнях съедает края, поэтому нужно сохранять покрытие
+    inline bool isCutout(const Level& level)
+    {
+        size_t transparent = 0, partial = 0, count = (size_t)level.width * level.height;
+        for (size_t i = 0; i < count; i++)
+        {
+            unsigned char alpha = level.pixels[i * 4 + 3];
+            if (alpha <= 16)
+                transparent++;
+            else if (alpha < 240)
+                partial++;
+        }
+        return transparent * 100 >= count && partial * 20 < count;
+    }
+}
+#endif
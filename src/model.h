@@ -5,19 +5,30 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
-#include "stb_image.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
 #include "mesh.h"
+#include "mesh_cache.h"
 #include "shader.h"
+#include "profiler.h"
+#include "thread_pool.h"
+#include "frustum.h"
+#include "instancing.h"
+#include "lod.h"
+#include "simplify.h"
+#include "mesh_optimizer.h"
+#include "animation.h"
+#include "texture_cache.h"
 
+#include <algorithm>
 #include <string>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <vector>
 using namespace std;
 
@@ -27,31 +38,494 @@ class Model
 {
 public:
     // Данные модели 
-    vector<Texture> textures_loaded; // (оптимизация) сохраняем все загруженные текстуры, чтобы убедиться, что они не загружены более одного раза
+    vector<TextureCache::Handle> textures_loaded; // ссылки на текстуры модели в общем кэше (textureCache()), одинаковые текстуры разных моделей загружаются один раз
     vector<Mesh> meshes;
     string directory;
     bool gammaCorrection;
+    bool keepCpuData; // false - после загрузки в OpenGL меши освобождают свои массивы вершин и индексов
+    GeometryPool* geometry; // общие буферы, в которых лежат все меши модели
+    glm::vec3 boundsMin = glm::vec3(0.0f), boundsMax = glm::vec3(0.0f); // ограничивающий параллелепипед всех мешей
+    VertexQuantization quantization; // диапазон позиций сжатых вершин (параллелепипед модели)
+    Skeleton skeleton;                // пуст, если у модели нет костей
+    vector<AnimationClip> animations;
 
-    // Конструктор в качестве аргумента использует путь к 3D-модели
-    Model(string const &path, bool gamma = false) : gammaCorrection(gamma)
+    // Конструктор в качестве аргумента использует путь к 3D-модели. Если пул геометрии не передан,
+    // модель создает собственный с вершинами формата format размером ровно под свои меши (он создается после
+    // импорта, когда число вершин и индексов известно); общий пул позволяет держать в одних буферах
+    // сразу несколько моделей (тогда формат задает пул). Модели со сжатыми вершинами (VertexFormat::Packed)
+    // рисуются шейдерами shaders/model_packed*.vs
+    Model(string const &path, bool gamma = false, bool keepCpuData = true, GeometryPool* pool = nullptr, VertexFormat format = VertexFormat::Full)
+        : gammaCorrection(gamma), keepCpuData(keepCpuData), geometry(pool)
     {
+        ownFormat = format;
         loadModel(path);
+        // Модель не загрузилась: пустой пул, чтобы отрисовка и release() работали как обычно
+        reserveGeometry(path, 0, 0);
+        buildBatches();
+        for(const TextureCache::Handle &texture : textures_loaded)
+            if(find(textureIds.begin(), textureIds.end(), texture.id()) == textureIds.end())
+                textureIds.push_back(texture.id());
     }
 
-    // Отрисовываем модель, а значит и все её меши
-    void Draw(Shader shader)
+    // Отрисовываем модель, а значит и все её меши. VAO привязывается один раз, а подряд идущие меши
+    // с одинаковыми текстурами рисуются одним вызовом glMultiDrawElementsBaseVertex.
+    // Все массивы вызовов подготовлены при загрузке, так что отрисовка не выделяет память.
+    // Размер на экране неизвестен, поэтому у потоковых текстур запрашивается полная детализация
+    void Draw(const Shader &shader, int lod = 0)
     {
-        for(unsigned int i = 0; i < meshes.size(); i++)
-            meshes[i].Draw(shader);
+        requestTextures(FULL_DETAIL);
+        drawLod(shader, lod);
+    }
+
+    // Отрисовка с выбором уровня детализации по размеру модели на экране. lodState хранит уровень
+    // прошлого кадра (для гистерезиса); у каждого объекта, рисуемого этой моделью, должен быть свой
+    void Draw(const Shader &shader, const LodView &view, const glm::mat4 &model, int &lodState)
+    {
+        float size = screenSize(view, model);
+        lodState = view.select(size, lodState, lodCount());
+        requestTextures(size);
+        drawLod(shader, lodState);
+    }
+
+    // Число уровней детализации (не меньше 1)
+    int lodCount() const { return (int)lodBatches.size(); }
+
+    // Число треугольников модели на уровне детализации lod
+    unsigned long long lodTriangles(int lod) const
+    {
+        unsigned long long triangles = 0;
+        for(const DrawBatch &batch : lodBatches[lod])
+            triangles += batch.triangles;
+        return triangles;
+    }
+
+    // Уровень детализации для модели с матрицей model; current - уровень прошлого кадра
+    int selectLod(const LodView &view, const glm::mat4 &model, int current) const
+    {
+        return view.select(screenSize(view, model), current, lodCount());
+    }
+
+    // Высота ограничивающей сферы модели с матрицей model на экране в пикселях
+    float screenSize(const LodView &view, const glm::mat4 &model) const
+    {
+        glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+        float radius = glm::length(boundsMax - center) * maxScale(model);
+        return view.screenSize(glm::vec3(model * glm::vec4(center, 1.0f)), radius);
+    }
+
+    // Отрисовка многих копий модели: экземпляры, ограничивающая сфера которых не попадает в пирамиду
+    // видимости, отбрасываются на CPU, матрицы остальных загружаются в буфер экземпляров, и каждый меш
+    // рисуется одним вызовом glDrawElementsInstancedBaseVertex. Нужен шейдер, читающий матрицу
+    // из атрибутов экземпляра (shaders/model_instanced.vs). Если передан lodView, уровень детализации
+    // выбирается для каждого экземпляра отдельно (состояние гистерезиса хранится по индексу экземпляра,
+    // поэтому из кадра в кадр нужно передавать один и тот же массив)
+    void DrawInstanced(const Shader &shader, const glm::mat4* transforms, size_t count, const Frustum &frustum, const LodView* lodView = nullptr)
+    {
+        // Ограничивающая сфера модели в её собственных координатах
+        glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+        float radius = glm::length(boundsMax - center);
+
+        beginInstances(count);
+        for(size_t i = 0; i < count; i++)
+        {
+            const glm::mat4 &m = transforms[i];
+            glm::vec3 worldCenter = glm::vec3(m * glm::vec4(center, 1.0f));
+            float worldRadius = radius * maxScale(m);
+            if(frustum.intersectsSphere(worldCenter, worldRadius))
+                addInstance(i, m, worldCenter, worldRadius, lodView);
+        }
+        drawVisibleInstances(shader);
+    }
+
+    // То же для компактных экземпляров (позиция, поворот, масштаб)
+    void DrawInstanced(const Shader &shader, const Instance* instances, size_t count, const Frustum &frustum, const LodView* lodView = nullptr)
+    {
+        glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+        float radius = glm::length(boundsMax - center);
+
+        beginInstances(count);
+        for(size_t i = 0; i < count; i++)
+        {
+            const Instance &instance = instances[i];
+            glm::vec3 worldCenter = instance.position + instance.rotation * (center * instance.scale);
+            float worldRadius = radius * glm::abs(instance.scale);
+            if(frustum.intersectsSphere(worldCenter, worldRadius))
+                addInstance(i, instance.matrix(), worldCenter, worldRadius, lodView);
+        }
+        drawVisibleInstances(shader);
+    }
+
+    // Отрисовка анимированных экземпляров (шейдер shaders/model_skinned_instanced.vs). Палитры костей
+    // вычисляются только для экземпляров, прошедших отсечение, параллельно в пуле потоков (у каждого
+    // экземпляра свой AnimationState с курсорами ключевых кадров), и загружаются в буфер текстуры в порядке
+    // отрисовки, так что шейдер находит палитру по gl_InstanceID. Буфер текстуры не может быть больше
+    // GL_MAX_TEXTURE_BUFFER_SIZE текселей (в OpenGL 3.3 гарантировано только 65536, т.е. 64 экземпляра по 256 костей),
+    // поэтому экземпляры рисуются частями, палитры которых помещаются в буфер. Время анимации states[i].time
+    // продвигает вызывающий код. Рисуется уровень детализации 0. В сжатых вершинах нет костей, поэтому
+    // модели формата VertexFormat::Packed не рисуются (сообщение выводится один раз)
+    void DrawAnimated(const Shader &shader, const glm::mat4* transforms, AnimationState* states, size_t count, const Frustum &frustum)
+    {
+        if(geometry->format == VertexFormat::Packed)
+        {
+            if(!packedSkinningReported)
+                cout << "ERROR::MODEL::PACKED_SKINNING DrawAnimated needs a model with full vertices" << endl;
+            packedSkinningReported = true;
+            return;
+        }
+        if(skeleton.empty() || animations.empty())
+        {
+            DrawInstanced(shader, transforms, count, frustum);
+            return;
+        }
+        glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+        float radius = glm::length(boundsMax - center);
+
+        visibleInstances.clear();
+        visibleInstances.reserve(count);
+        visibleStates.clear();
+        visibleStates.reserve(count);
+        for(size_t i = 0; i < count; i++)
+        {
+            const glm::mat4 &m = transforms[i];
+            if(frustum.intersectsSphere(glm::vec3(m * glm::vec4(center, 1.0f)), radius * maxScale(m)))
+            {
+                visibleInstances.push_back(m);
+                visibleStates.push_back(&states[i]);
+            }
+        }
+        if(visibleInstances.empty())
+            return;
+
+        size_t boneCount = skeleton.bones.size();
+        palettes.resize(visibleStates.size() * boneCount);
+        {
+            PROFILE_SCOPE("sample animations");
+            workerPool().parallelFor(visibleStates.size(), [&](size_t i) {
+                AnimationState &state = *visibleStates[i];
+                const AnimationClip &clip = animations[glm::clamp(state.clip, 0, (int)animations.size() - 1)];
+                state.sampler.sample(clip, state.time, skeleton, &palettes[i * boneCount]);
+            });
+        }
+
+        if(!paletteBuffer)
+            paletteBuffer.reset(new BonePaletteBuffer());
+        if(!instanceBuffer)
+            instanceBuffer.reset(new InstanceBuffer(visibleInstances.size()));
+        instanceBuffer->upload(visibleInstances.data(), visibleInstances.size());
+
+        if(paletteProgram != shader.ID)
+        {
+            paletteProgram = shader.ID;
+            paletteLocation = glGetUniformLocation(shader.ID, "bonePalette");
+            boneCountLocation = glGetUniformLocation(shader.ID, "boneCount");
+        }
+        glUniform1i(paletteLocation, BonePaletteBuffer::TEXTURE_UNIT);
+        glUniform1i(boneCountLocation, (GLint)boneCount);
+        requestTextures(FULL_DETAIL);
+
+        if(maxPaletteTexels == 0)
+        {
+            GLint limit = 0;
+            glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &limit);
+            maxPaletteTexels = limit > 0 ? (size_t)limit : 65536;
+        }
+        size_t chunk = glm::max(maxPaletteTexels / (boneCount * 4), (size_t)1);
+
+        glBindVertexArray(geometry->VAO);
+        for(size_t first = 0; first < visibleInstances.size(); first += chunk)
+        {
+            size_t chunkCount = glm::min(chunk, visibleInstances.size() - first);
+            paletteBuffer->upload(&palettes[first * boneCount], chunkCount * boneCount);
+            paletteBuffer->bind();
+            instanceBuffer->bind(first);
+            GLsizei instanceCount = (GLsizei)chunkCount;
+            for(const DrawBatch &batch : lodBatches[0])
+            {
+                meshes[batch.mesh].bindTextures(shader);
+                for(size_t i = 0; i < batch.counts.size(); i++)
+                {
+                    glDrawElementsInstancedBaseVertex(GL_TRIANGLES, batch.counts[i], GL_UNSIGNED_INT, batch.offsets[i], instanceCount, batch.baseVertices[i]);
+                    renderStats().draw(batch.counts[i] / 3, instanceCount);
+                }
+            }
+        }
+        InstanceBuffer::unbind();
+        glBindVertexArray(0);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    // Число экземпляров, прошедших отсечение в последнем вызове DrawInstanced
+    size_t visibleInstanceCount() const { return visibleInstances.size(); }
+
+    // Удаление объектов OpenGL модели (до уничтожения контекста)
+    void release()
+    {
+        if(instanceBuffer)
+            instanceBuffer->release();
+        if(paletteBuffer)
+            paletteBuffer->release();
+        textures_loaded.clear(); // текстуры удаляет кэш, когда на них не останется ссылок
+        if(ownGeometry)
+            ownGeometry->release();
     }
     
 private:
-    // Загружаем модель с помощью Assimp и сохраняем полученные меши в векторе meshes
+    // Меши с одинаковым материалом, идущие подряд: рисуются одним вызовом
+    struct DrawBatch {
+        size_t mesh; // меш, текстуры которого привязываются перед вызовом
+        vector<GLsizei> counts;
+        vector<const void*> offsets;
+        vector<GLint> baseVertices;
+        unsigned long long triangles = 0;
+    };
+
+    // Уровни детализации, порождаемые при импорте: каждый следующий - примерно вдвое меньше треугольников
+    static const int LOD_LEVELS = 3;
+    static const unsigned int LOD_MIN_TRIANGLES = 256; // меньшие меши не упрощаются
+
+    // Размер на экране, при котором потоковым текстурам нужен самый крупный мип-уровень
+    static constexpr float FULL_DETAIL = 1e30f;
+
+    unique_ptr<GeometryPool> ownGeometry;
+    VertexFormat ownFormat = VertexFormat::Full; // формат вершин собственного пула
+    vector<unsigned int> textureIds;           // текстуры модели без повторов (для запросов потоковой загрузки)
+    float visibleScreenSize = 0.0f;            // наибольший размер на экране среди экземпляров кадра
+    vector<vector<DrawBatch>> lodBatches;      // пакеты вызовов для каждого уровня детализации
+    unique_ptr<InstanceBuffer> instanceBuffer; // создается при первом вызове DrawInstanced
+    unique_ptr<BonePaletteBuffer> paletteBuffer; // создается при первом вызове DrawAnimated
+    vector<AnimationState*> visibleStates;      // состояния анимации видимых экземпляров
+    vector<glm::mat4> palettes;                 // палитры костей видимых экземпляров подряд
+    unsigned int paletteProgram = 0;
+    GLint paletteLocation = -1, boneCountLocation = -1;
+    size_t maxPaletteTexels = 0;                // GL_MAX_TEXTURE_BUFFER_SIZE (запрашивается при первом DrawAnimated)
+    bool packedSkinningReported = false;
+    // Буферы экземпляров переиспользуются между кадрами, чтобы не выделять память
+    vector<glm::mat4> visibleInstances;
+    vector<unsigned char> visibleLods;   // уровень детализации каждого видимого экземпляра
+    vector<unsigned char> instanceLods;  // уровень прошлого кадра по индексу экземпляра
+    vector<glm::mat4> sortedInstances;   // видимые экземпляры, сгруппированные по уровням
+    vector<size_t> lodFirst;             // начало группы каждого уровня в sortedInstances
+    // Location uniform-переменных декодирования позиций в последней программе (ищутся при смене программы)
+    unsigned int quantizationProgram = 0;
+    GLint positionOffsetLocation = -1, positionScaleLocation = -1;
+
+    // Передача диапазона позиций в шейдер сжатых вершин
+    void setQuantization(const Shader &shader)
+    {
+        if(geometry->format != VertexFormat::Packed)
+            return;
+        if(quantizationProgram != shader.ID)
+        {
+            quantizationProgram = shader.ID;
+            positionOffsetLocation = glGetUniformLocation(shader.ID, "positionOffset");
+            positionScaleLocation = glGetUniformLocation(shader.ID, "positionScale");
+        }
+        glUniform3fv(positionOffsetLocation, 1, &quantization.offset[0]);
+        glUniform3fv(positionScaleLocation, 1, &quantization.scale[0]);
+    }
+
+    // Диапазон квантования - общий параллелепипед всех мешей модели: у мешей одна пара uniform-переменных,
+    // поэтому они по-прежнему рисуются общими пакетами
+    template <typename GetVertices>
+    void computeQuantization(size_t meshCount, GetVertices getVertices)
+    {
+        bool empty = true;
+        glm::vec3 lo(0.0f), hi(0.0f);
+        for(size_t i = 0; i < meshCount; i++)
+        {
+            pair<const Vertex*, size_t> data = getVertices(i);
+            for(size_t v = 0; v < data.second; v++)
+            {
+                lo = empty ? data.first[v].Position : glm::min(lo, data.first[v].Position);
+                hi = empty ? data.first[v].Position : glm::max(hi, data.first[v].Position);
+                empty = false;
+            }
+        }
+        quantization = VertexQuantization::fromBounds(lo, hi);
+    }
+
+    void drawLod(const Shader &shader, int lod)
+    {
+        setQuantization(shader);
+        glBindVertexArray(geometry->VAO);
+        for(const DrawBatch &batch : lodBatches[glm::clamp(lod, 0, lodCount() - 1)])
+        {
+            meshes[batch.mesh].bindTextures(shader);
+            if(batch.counts.size() == 1)
+                glDrawElementsBaseVertex(GL_TRIANGLES, batch.counts[0], GL_UNSIGNED_INT, batch.offsets[0], batch.baseVertices[0]);
+            else
+                glMultiDrawElementsBaseVertex(GL_TRIANGLES, batch.counts.data(), GL_UNSIGNED_INT, batch.offsets.data(), (GLsizei)batch.counts.size(), batch.baseVertices.data());
+            renderStats().draw(batch.triangles);
+        }
+        glBindVertexArray(0);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    // Размер модели на экране для выбора мип-уровней потоковых текстур (texture_streamer.h)
+    void requestTextures(float screenSize) const
+    {
+        for(unsigned int id : textureIds)
+            textureStreamer().request(id, screenSize);
+    }
+
+    // Наибольший масштаб по осям матрицы
+    static float maxScale(const glm::mat4 &m)
+    {
+        return glm::sqrt(glm::max(glm::dot(glm::vec3(m[0]), glm::vec3(m[0])),
+                         glm::max(glm::dot(glm::vec3(m[1]), glm::vec3(m[1])), glm::dot(glm::vec3(m[2]), glm::vec3(m[2])))));
+    }
+
+    void beginInstances(size_t count)
+    {
+        visibleInstances.clear();
+        visibleInstances.reserve(count);
+        visibleLods.clear();
+        visibleLods.reserve(count);
+        visibleScreenSize = 0.0f;
+        if(instanceLods.size() != count)
+            instanceLods.assign(count, 0xFF);
+    }
+
+    void addInstance(size_t index, const glm::mat4 &m, const glm::vec3 &worldCenter, float worldRadius, const LodView* lodView)
+    {
+        int lod = 0;
+        float size = FULL_DETAIL;
+        if(lodView)
+        {
+            int previous = instanceLods[index] == 0xFF ? -1 : instanceLods[index];
+            size = lodView->screenSize(worldCenter, worldRadius);
+            lod = lodView->select(size, previous, lodCount());
+            instanceLods[index] = (unsigned char)lod;
+        }
+        visibleScreenSize = glm::max(visibleScreenSize, size);
+        visibleInstances.push_back(m);
+        visibleLods.push_back((unsigned char)lod);
+    }
+
+    void drawVisibleInstances(const Shader &shader)
+    {
+        if(visibleInstances.empty())
+            return;
+
+        // Группируем экземпляры по уровням детализации (сортировка подсчетом)
+        lodFirst.assign(lodCount() + 1, 0);
+        for(unsigned char lod : visibleLods)
+            lodFirst[lod + 1]++;
+        for(int lod = 0; lod < lodCount(); lod++)
+            lodFirst[lod + 1] += lodFirst[lod];
+        sortedInstances.resize(visibleInstances.size());
+        for(size_t i = 0; i < visibleInstances.size(); i++)
+            sortedInstances[lodFirst[visibleLods[i]]++] = visibleInstances[i];
+        for(int lod = lodCount(); lod > 0; lod--)
+            lodFirst[lod] = lodFirst[lod - 1];
+        lodFirst[0] = 0;
+
+        if(!instanceBuffer)
+            instanceBuffer.reset(new InstanceBuffer(sortedInstances.size()));
+        instanceBuffer->upload(sortedInstances.data(), sortedInstances.size());
+        setQuantization(shader);
+        requestTextures(visibleScreenSize);
+
+        glBindVertexArray(geometry->VAO);
+        for(int lod = 0; lod < lodCount(); lod++)
+        {
+            GLsizei instanceCount = (GLsizei)(lodFirst[lod + 1] - lodFirst[lod]);
+            if(instanceCount == 0)
+                continue;
+            instanceBuffer->bind(lodFirst[lod]);
+            for(const DrawBatch &batch : lodBatches[lod])
+            {
+                meshes[batch.mesh].bindTextures(shader);
+                // В OpenGL 3.3 нет instanced-варианта glMultiDraw*, поэтому меши пакета рисуются по одному
+                for(size_t i = 0; i < batch.counts.size(); i++)
+                {
+                    glDrawElementsInstancedBaseVertex(GL_TRIANGLES, batch.counts[i], GL_UNSIGNED_INT, batch.offsets[i], instanceCount, batch.baseVertices[i]);
+                    renderStats().draw(batch.counts[i] / 3, instanceCount);
+                }
+            }
+        }
+        InstanceBuffer::unbind();
+        glBindVertexArray(0);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    void buildBatches()
+    {
+        int levels = 1;
+        for(size_t i = 0; i < meshes.size(); i++)
+        {
+            boundsMin = i ? glm::min(boundsMin, meshes[i].boundsMin) : meshes[i].boundsMin;
+            boundsMax = i ? glm::max(boundsMax, meshes[i].boundsMax) : meshes[i].boundsMax;
+            levels = glm::max(levels, (int)meshes[i].lods.size());
+        }
+
+        // Меш, у которого уровней меньше, чем у модели, на грубых уровнях рисуется своим последним уровнем
+        lodBatches.assign(levels, vector<DrawBatch>());
+        for(int lod = 0; lod < levels; lod++)
+        {
+            vector<DrawBatch> &batches = lodBatches[lod];
+            for(size_t i = 0; i < meshes.size(); i++)
+            {
+                if(batches.empty() || !meshes[batches.back().mesh].sameMaterial(meshes[i]))
+                {
+                    batches.push_back(DrawBatch());
+                    batches.back().mesh = i;
+                }
+                DrawBatch &batch = batches.back();
+                const GeometryPool::Range &range = meshes[i].lods[glm::min(lod, (int)meshes[i].lods.size() - 1)];
+                batch.counts.push_back((GLsizei)range.indexCount);
+                batch.offsets.push_back(range.indexOffset());
+                batch.baseVertices.push_back(range.baseVertex);
+                batch.triangles += range.indexCount / 3;
+            }
+        }
+    }
+
+    // Цепочка уровней детализации меша: каждый уровень упрощается из предыдущего до половины
+    // треугольников. Уровень, который не удалось заметно упростить (швы, границы, предел ошибки), не добавляется
+    static void buildLods(const vector<Vertex> &vertices, const vector<unsigned int> &indices, vector<vector<unsigned int>> &lods)
+    {
+        if(indices.size() / 3 < LOD_MIN_TRIANGLES)
+            return;
+        const vector<unsigned int>* previous = &indices;
+        for(int level = 1; level <= LOD_LEVELS; level++)
+        {
+            float maxError = 0.01f * (float)(1 << level); // 2%, 4%, 8% размера меша
+            vector<unsigned int> lod = Simplify::simplify(vertices.data(), vertices.size(), previous->data(), previous->size(), previous->size() / 2, maxError);
+            if(lod.empty() || lod.size() > previous->size() * 3 / 4)
+                break;
+            lods.push_back(std::move(lod));
+            previous = &lods.back();
+            // Упрощение сохраняет порядок треугольников, но после стягиваний он уже не оптимален для кэша
+            MeshOptimizer::optimizeVertexCache(lods.back(), vertices.size());
+        }
+    }
+
+    // Флаги постобработки Assimp; записываются в кэш, т.к. влияют на результат импорта
+    // (LimitBoneWeights оставляет у вершины не больше четырех костей)
+    static const unsigned int IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_CalcTangentSpace | aiProcess_LimitBoneWeights;
+
+    // Загружаем модель: сначала из двоичного кэша рядом с файлом (<path>.l1mesh), а если он отсутствует
+    // или устарел - с помощью Assimp, после чего кэш создается заново
     void loadModel(string const &path)
     {
+        PROFILE_SCOPE("import model");
+
+        // Получение пути к файлу
+        directory = path.substr(0, path.find_last_of('/'));
+
+        string cachePath = path + ".l1mesh";
+        uint64_t sourceHash = hashFile(path);
+        if(sourceHash && loadBaked(cachePath, path, sourceHash))
+            return;
+
         // Чтение файла с помощью Assimp
         Assimp::Importer importer;
-        const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
+        const aiScene* scene;
+        {
+            PROFILE_SCOPE("assimp ReadFile");
+            scene = importer.ReadFile(path, IMPORT_FLAGS);
+        }
 		
         // Проверка на ошибки
         if(!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) // если НЕ 0
@@ -59,39 +533,183 @@ private:
             cout << "ERROR::ASSIMP:: " << importer.GetErrorString() << endl;
             return;
         }
-		
-        // Получение пути к файлу
-        directory = path.substr(0, path.find_last_of('/'));
 
-        // Рекурсивная обработка корневого узла Assimp
-        processNode(scene->mRootNode, scene);
+        // Скелет и анимации (в двоичный кэш не записываются, поэтому анимированные модели всегда импортируются)
+        if(!skeleton.build(scene))
+        {
+            cout << "ERROR::MODEL::TOO_MANY_BONES " << path << endl;
+            skeleton = Skeleton();
+        }
+        if(!skeleton.empty())
+            for(unsigned int i = 0; i < scene->mNumAnimations; i++)
+                animations.emplace_back(scene->mAnimations[i], skeleton);
+
+        // Рекурсивная обработка корневого узла Assimp: собираем меши в порядке обхода узлов
+        vector<aiMesh*> sceneMeshes;
+        sceneMeshes.reserve(scene->mNumMeshes);
+        processNode(scene->mRootNode, scene, sceneMeshes);
+
+        // Преобразование в массивы Vertex не зависит от других мешей и OpenGL, поэтому выполняется параллельно
+        // в пуле потоков. Результат i-го меша пишется в i-ю ячейку, так что порядок мешей сохраняется
+        vector<vector<Vertex>> vertices(sceneMeshes.size());
+        vector<vector<VertexBones>> bones(sceneMeshes.size());
+        vector<vector<unsigned int>> indices(sceneMeshes.size());
+        vector<vector<vector<unsigned int>>> lods(sceneMeshes.size());
+        vector<MeshOptimizer::CacheStatistics> before(sceneMeshes.size()), after(sceneMeshes.size());
+        {
+            PROFILE_SCOPE("convert meshes");
+            workerPool().parallelFor(sceneMeshes.size(), [&](size_t i) {
+                PROFILE_SCOPE("convert mesh");
+                processMesh(sceneMeshes[i], skeleton, vertices[i], bones[i], indices[i]);
+                before[i] = MeshOptimizer::analyzeVertexCache(indices[i].data(), indices[i].size(), vertices[i].size());
+                {
+                    PROFILE_SCOPE("optimize mesh");
+                    MeshOptimizer::optimize(vertices[i], indices[i], bones[i]);
+                }
+                after[i] = MeshOptimizer::analyzeVertexCache(indices[i].data(), indices[i].size(), vertices[i].size());
+                PROFILE_SCOPE("build lods");
+                buildLods(vertices[i], indices[i], lods[i]);
+            });
+        }
+        reportOptimization(path, before, after);
+        computeQuantization(vertices.size(), [&](size_t i) { return make_pair((const Vertex*)vertices[i].data(), vertices[i].size()); });
+
+        // Текстуры материалов и буферы OpenGL создаются одним пакетом в потоке с контекстом
+        // Типы текстур в том же порядке и с теми же именами, что и в processMaterial
+        static const pair<aiTextureType, const char*> MATERIAL_TEXTURES[] = {
+            { aiTextureType_DIFFUSE, "texture_diffuse" }, { aiTextureType_SPECULAR, "texture_specular" },
+            { aiTextureType_HEIGHT, "texture_normal" }, { aiTextureType_AMBIENT, "texture_height" } };
+        vector<pair<string, string>> textureFiles;
+        for(aiMesh* mesh : sceneMeshes)
+        {
+            aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
+            for(const pair<aiTextureType, const char*> &type : MATERIAL_TEXTURES)
+                for(unsigned int i = 0; i < material->GetTextureCount(type.first); i++)
+                {
+                    aiString str;
+                    material->GetTexture(type.first, i, &str);
+                    textureFiles.push_back(make_pair(str.C_Str(), type.second));
+                }
+        }
+        vector<TextureCache::Handle> prefetched = prefetchTextures(textureFiles);
+        size_t vertexTotal = 0, indexTotal = 0;
+        for(size_t i = 0; i < sceneMeshes.size(); i++)
+        {
+            vertexTotal += vertices[i].size();
+            indexTotal += indices[i].size();
+            for(const vector<unsigned int> &lod : lods[i])
+                indexTotal += lod.size();
+        }
+        reserveGeometry(path, vertexTotal, indexTotal);
+        {
+            PROFILE_SCOPE("upload meshes");
+            meshes.reserve(sceneMeshes.size());
+            for(size_t i = 0; i < sceneMeshes.size(); i++)
+            {
+                meshes.emplace_back(std::move(vertices[i]), std::move(indices[i]), processMaterial(sceneMeshes[i], scene), *geometry, quantization, std::move(bones[i]));
+                for(vector<unsigned int> &lod : lods[i])
+                    meshes.back().addLod(std::move(lod), *geometry);
+            }
+        }
+
+        if(sourceHash && skeleton.empty())
+        {
+            PROFILE_SCOPE("bake model");
+            MeshCache::write(cachePath, sourceHash, IMPORT_FLAGS, meshes);
+        }
+
+        // Кэш записан, копии данных в памяти CPU больше не нужны
+        if(!keepCpuData)
+            for(Mesh& mesh : meshes)
+                mesh.releaseCpuData();
+    }
+
+    // Эффективность кэша вершин до и после оптимизации мешей при импорте
+    static void reportOptimization(const string &path, const vector<MeshOptimizer::CacheStatistics> &before, const vector<MeshOptimizer::CacheStatistics> &after)
+    {
+        MeshOptimizer::CacheStatistics total, optimized;
+        for(size_t i = 0; i < before.size(); i++)
+        {
+            total += before[i];
+            optimized += after[i];
+        }
+        cout << "Mesh optimization " << path << ": vertices " << total.vertices << " -> " << optimized.vertices
+             << ", ACMR " << total.acmr() << " -> " << optimized.acmr()
+             << ", ATVR " << total.atvr() << " -> " << optimized.atvr() << endl;
+    }
+
+    // Загрузка мешей из кэша: файл отображается в память, и вершины передаются в OpenGL без промежуточных копий
+    bool loadBaked(const string &cachePath, const string &path, uint64_t sourceHash)
+    {
+        PROFILE_SCOPE("load baked model");
+        MappedFile file(cachePath);
+        vector<MeshCache::BakedMesh> baked;
+        if(!MeshCache::read(file, sourceHash, IMPORT_FLAGS, baked))
+            return false;
+
+        computeQuantization(baked.size(), [&](size_t i) { return make_pair(baked[i].vertices, (size_t)baked[i].vertexCount); });
+        vector<pair<string, string>> textureFiles;
+        for(const MeshCache::BakedMesh& mesh : baked)
+            for(unsigned int i = 0; i < mesh.textureCount; i++)
+                textureFiles.push_back(make_pair(mesh.textures[i].path, mesh.textures[i].type));
+        vector<TextureCache::Handle> prefetched = prefetchTextures(textureFiles);
+        size_t vertexTotal = 0, indexTotal = 0;
+        for(const MeshCache::BakedMesh& mesh : baked)
+        {
+            vertexTotal += mesh.vertexCount;
+            indexTotal += mesh.indexCount;
+            for(uint32_t lod = 0; lod < mesh.lodCount; lod++)
+                indexTotal += mesh.lods[lod].indexCount;
+        }
+        reserveGeometry(path, vertexTotal, indexTotal);
+        meshes.reserve(baked.size());
+        for(const MeshCache::BakedMesh& mesh : baked)
+        {
+            vector<Texture> textures;
+            for(unsigned int i = 0; i < mesh.textureCount; i++)
+                textures.push_back(loadTexture(mesh.textures[i].path, mesh.textures[i].type));
+            meshes.emplace_back(mesh.vertices, mesh.vertexCount, mesh.indices, mesh.indexCount, std::move(textures), *geometry, quantization);
+            for(uint32_t lod = 0; lod < mesh.lodCount; lod++)
+                meshes.back().addLod(mesh.lodIndices(lod), mesh.lods[lod].indexCount, *geometry);
+        }
+        return true;
+    }
+
+    // Собственный пул модели (если общий не передан) ровно на vertexCount вершин и indexCount индексов всех мешей
+    // и уровней детализации: пул с запасом на 64K вершин занимал бы несколько мегабайт видеопамяти даже у куба
+    void reserveGeometry(const string &path, size_t vertexCount, size_t indexCount)
+    {
+        if(geometry)
+            return;
+        ownGeometry.reset(new GeometryPool(std::max<size_t>(vertexCount, 1), std::max<size_t>(indexCount, 1), ownFormat, path));
+        geometry = ownGeometry.get();
     }
 
-    // Рекурсивная обработка узла. Обрабатываем каждый отдельный меш, расположенный в узле, и повторяем этот процесс для своих дочерних углов (если таковы вообще имеются)
-    void processNode(aiNode *node, const aiScene *scene)
+    // Рекурсивная обработка узла. Собираем каждый отдельный меш, расположенный в узле, и повторяем этот процесс для своих дочерних углов (если таковы вообще имеются)
+    void processNode(aiNode *node, const aiScene *scene, vector<aiMesh*> &result)
     {
-        // Обрабатываем каждый меш текущего узла
+        // Собираем каждый меш текущего узла
         for(unsigned int i = 0; i < node->mNumMeshes; i++)
         {
             // Узел содержит только индексы объектов в сцене.
             // Сцена же содержит все данные; узел - это лишь способ организации данных
-            aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-            meshes.push_back(processMesh(mesh, scene));
+            result.push_back(scene->mMeshes[node->mMeshes[i]]);
         }
         // После того, как мы обработали все меши (если таковые имелись), мы начинаем рекурсивно обрабатывать каждый из дочерних узлов
         for(unsigned int i = 0; i < node->mNumChildren; i++)
         {
-            processNode(node->mChildren[i], scene);
+            processNode(node->mChildren[i], scene, result);
         }
 
     }
 
-    Mesh processMesh(aiMesh *mesh, const aiScene *scene)
+    // Преобразование вершин и граней меша. Не обращается ни к OpenGL, ни к полям модели,
+    // поэтому безопасно вызывается из рабочих потоков. bones заполняется только у меша с костями
+    static void processMesh(const aiMesh *mesh, const Skeleton &skeleton, vector<Vertex> &vertices, vector<VertexBones> &bones, vector<unsigned int> &indices)
     {
-        // Данные для заполнения
-        vector<Vertex> vertices;
-        vector<unsigned int> indices;
-        vector<Texture> textures;
+        // Размеры известны заранее, поэтому память выделяется один раз, без перераспределений при push_back
+        vertices.reserve(mesh->mNumVertices);
+        indices.reserve((size_t)mesh->mNumFaces * 3);
 
         // Цикл по всем вершинам меша
         for(unsigned int i = 0; i < mesh->mNumVertices; i++)
@@ -138,6 +756,7 @@ private:
             vertex.Bitangent = vector;
             vertices.push_back(vertex);
         }
+        processBones(mesh, skeleton, bones);
         // Теперь проходимся по каждой грани меша (грань - это треугольник меша) и извлекаем соответствующие индексы вершин
         for(unsigned int i = 0; i < mesh->mNumFaces; i++)
         {
@@ -147,7 +766,55 @@ private:
             for(unsigned int j = 0; j < face.mNumIndices; j++)
                 indices.push_back(face.mIndices[j]);
         }
-		
+    }
+
+    // Кости и веса вершин. Assimp хранит для каждой кости список вершин; после LimitBoneWeights у вершины
+    // не больше четырех костей. Веса нормируются и переводятся в байты с суммой ровно 255
+    static void processBones(const aiMesh *mesh, const Skeleton &skeleton, vector<VertexBones> &bones)
+    {
+        if(!mesh->HasBones() || skeleton.empty())
+            return;
+        bones.assign(mesh->mNumVertices, VertexBones());
+        vector<glm::vec4> weights(bones.size(), glm::vec4(0.0f));
+        vector<unsigned char> used(bones.size(), 0);
+        for(unsigned int b = 0; b < mesh->mNumBones; b++)
+        {
+            const aiBone* bone = mesh->mBones[b];
+            auto found = skeleton.boneIndex.find(bone->mName.C_Str());
+            if(found == skeleton.boneIndex.end())
+                continue;
+            for(unsigned int w = 0; w < bone->mNumWeights; w++)
+            {
+                unsigned int v = bone->mWeights[w].mVertexId;
+                if(v >= bones.size() || used[v] >= 4)
+                    continue;
+                bones[v].Ids[used[v]] = (unsigned char)found->second;
+                weights[v][used[v]++] = bone->mWeights[w].mWeight;
+            }
+        }
+        for(size_t v = 0; v < bones.size(); v++)
+        {
+            float sum = weights[v].x + weights[v].y + weights[v].z + weights[v].w;
+            if(sum <= 0.0f)
+                continue;
+            int total = 0, largest = 0;
+            for(int k = 0; k < 4; k++)
+            {
+                bones[v].Weights[k] = (unsigned char)glm::round(weights[v][k] / sum * 255.0f);
+                total += bones[v].Weights[k];
+                if(weights[v][k] > weights[v][largest])
+                    largest = k;
+            }
+            // Ошибка округления (не больше 2) добавляется к самому большому весу
+            bones[v].Weights[largest] = (unsigned char)(bones[v].Weights[largest] + 255 - total);
+        }
+    }
+
+    // Текстуры материала меша (загружаются в OpenGL, поэтому только в потоке с контекстом)
+    vector<Texture> processMaterial(const aiMesh *mesh, const aiScene *scene)
+    {
+        vector<Texture> textures;
+
         // Обрабатываем материалы
         aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];  
 		
@@ -174,8 +841,7 @@ private:
         std::vector<Texture> heightMaps = loadMaterialTextures(material, aiTextureType_AMBIENT, "texture_height");
         textures.insert(textures.end(), heightMaps.begin(), heightMaps.end());
         
-        // Возвращаем меш-объект, созданный на основе полученных данных
-        return Mesh(vertices, indices, textures);
+        return textures;
     }
 
     // Проверяем все текстуры материалов заданного типа и загружам текстуры, если они еще не были загружены.
@@ -188,69 +854,51 @@ private:
             aiString str;
             mat->GetTexture(type, i, &str);
 			
-            // Проверяем, не была ли текстура загружена ранее, и если - да, то пропускаем загрузку новой текстуры и переходим к следующей итерации
-            bool skip = false;
-            for(unsigned int j = 0; j < textures_loaded.size(); j++)
-            {
-                if(std::strcmp(textures_loaded[j].path.data(), str.C_Str()) == 0)
-                {
-                    textures.push_back(textures_loaded[j]);
-                    skip = true; // текстура с тем же путем к файлу уже загружена, переходим к следующей (оптимизация)
-                    break;
-                }
-            }
-            if(!skip)
-            {   // если текстура еще не была загружена, то загружаем её
-                Texture texture;
-                texture.id = TextureFromFile(str.C_Str(), this->directory);
-                texture.type = typeName;
-                texture.path = str.C_Str();
-                textures.push_back(texture);
-                textures_loaded.push_back(texture); // сохраняем текстуру в массиве с уже загруженными текстурами, тем самым гарантируя, что у нас не появятся без необходимости дубликаты текстур
-            }
+            textures.push_back(loadTexture(str.C_Str(), typeName));
         }
         return textures;
     }
-};
-
 
-unsigned int TextureFromFile(const char *path, const string &directory, bool gamma)
-{
-    string filename = string(path);
-    filename = directory + '/' + filename;
-
-    unsigned int textureID;
-    glGenTextures(1, &textureID);
-
-    int width, height, nrComponents;
-    unsigned char *data = stbi_load(filename.c_str(), &width, &height, &nrComponents, 0);
-    if (data)
+    // Параметры текстур материалов: диффузные карты хранят цвет в sRGB и при чтении переводятся в линейное
+    // пространство оборудованием, остальные карты (отражения, нормали, высоты) - линейные данные.
+    // Крупные мип-уровни запеченных текстур подгружаются, когда модель видна достаточно крупно
+    // (размер на экране передают методы Draw*)
+    static TextureParams textureParams(const string &typeName)
     {
-        GLenum format;
-        if (nrComponents == 1)
-            format = GL_RED;
-        else if (nrComponents == 3)
-            format = GL_RGB;
-        else if (nrComponents == 4)
-            format = GL_RGBA;
-
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        TextureParams params;
+        params.srgb = typeName == "texture_diffuse";
+        params.stream = true;
+        return params;
+    }
 
-        stbi_image_free(data);
+    // Все текстуры модели загружаются в кэш одним пакетом (файлы декодируются параллельно), после чего
+    // loadTexture находит их в кэше. Возвращаемые ссылки удерживают текстуры до конца загрузки модели
+    vector<TextureCache::Handle> prefetchTextures(const vector<pair<string, string>> &files)
+    {
+        vector<TextureRequest> requests;
+        for(const pair<string, string> &file : files)
+            requests.push_back({ this->directory + '/' + file.first, textureParams(file.second) });
+        return textureCache().acquire(requests);
     }
-    else
+
+    // Текстура берется из общего кэша: если её уже загрузила эта или другая модель, файл повторно не читается
+    Texture loadTexture(const char *path, const string &typeName)
     {
-        std::cout << "Texture failed to load at path: " << path << std::endl;
-        stbi_image_free(data);
+        textures_loaded.push_back(textureCache().acquire(this->directory + '/' + path, textureParams(typeName)));
+        Texture texture;
+        texture.id = textures_loaded.back().id();
+        texture.type = typeName;
+        texture.path = path;
+        return texture;
     }
+};
 
-    return textureID;
+
+// Загрузка текстуры для кода, которому нужен только идентификатор OpenGL (текстура закреплена в кэше до его release())
+unsigned int TextureFromFile(const char *path, const string &directory, bool gamma)
+{
+    TextureParams params;
+    params.srgb = gamma;
+    return textureCache().load(directory + '/' + path, params);
 }
 #endif
\ No newline at end of file
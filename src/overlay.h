@@ -0,0 +1,79 @@
+#ifndef OVERLAY_H
+#define OVERLAY_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "shader.h"
+
+// Простейший оверлей поверх кадра: цветные прямоугольники в нормализованных координатах устройства.
+// Используется для графиков профилировщика и отчетов о ресурсах
+class Overlay
+{
+public:
+    Overlay() : shader("../src/shaders/overlay.vs", "../src/shaders/overlay.fs")
+    {
+        // Единичный квадрат, растягиваемый в шейдере uniform-переменной rect
+        float quad[] = {
+            0.0f, 0.0f,
+            1.0f, 0.0f,
+            0.0f, 1.0f,
+            1.0f, 1.0f,
+        };
+
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glBindVertexArray(0);
+
+        rectLocation = glGetUniformLocation(shader.ID, "rect");
+        colorLocation = glGetUniformLocation(shader.ID, "color");
+    }
+
+    // Освобождение ресурсов OpenGL (вызывается до уничтожения контекста)
+    void release()
+    {
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteProgram(shader.ID);
+    }
+
+    Overlay(const Overlay&) = delete;
+    Overlay& operator=(const Overlay&) = delete;
+
+    // Начало отрисовки оверлея: без теста глубины, с альфа-смешиванием
+    void begin()
+    {
+        glDisable(GL_DEPTH_TEST);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        shader.use();
+        glBindVertexArray(VAO);
+    }
+
+    // Прямоугольник с левым нижним углом (x, y) и размерами (w, h) в NDC
+    void rect(float x, float y, float w, float h, const glm::vec4& color)
+    {
+        glUniform4f(rectLocation, x, y, w, h);
+        glUniform4fv(colorLocation, 1, &color[0]);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    }
+
+    // Возвращаем глобальное состояние OpenGL
+    void end()
+    {
+        glBindVertexArray(0);
+        glDisable(GL_BLEND);
+        glEnable(GL_DEPTH_TEST);
+    }
+
+private:
+    Shader shader;
+    unsigned int VAO, VBO;
+    int rectLocation, colorLocation;
+};
+#endif
@@ -0,0 +1,161 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Инструментирование CPU с выгрузкой в формате Chrome trace (chrome://tracing, Perfetto).
+// Включается определением LESSON1_PROFILING (опция CMake LESSON1_PROFILING). Без него
+// макросы PROFILE_* раскрываются в пустоту, и инструментирование ничего не стоит
+#ifdef LESSON1_PROFILING
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Profiler
+{
+public:
+    // Размер кольцевого буфера потока; старые события перезаписываются
+    static const uint32_t CAPACITY = 1 << 16;
+
+    struct Event {
+        const char* name; // только строковые литералы: сохраняется указатель, а не копия
+        uint64_t start;   // наносекунды steady_clock
+        uint64_t end;
+    };
+
+    // Буфер событий одного потока. Пишет только поток-владелец, поэтому запись не требует блокировок:
+    // событие записывается в ячейку, после чего счетчик head публикуется с семантикой release
+    struct ThreadBuffer {
+        std::vector<Event> events;
+        std::atomic<uint64_t> head{ 0 };
+        uint32_t tid = 0;
+        std::string name;
+    };
+
+    static uint64_t now()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void record(const char* name, uint64_t start, uint64_t end)
+    {
+        ThreadBuffer& buffer = threadBuffer();
+        uint64_t head = buffer.head.load(std::memory_order_relaxed);
+        buffer.events[head & (CAPACITY - 1)] = { name, start, end };
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    static void setThreadName(const char* name)
+    {
+        threadBuffer().name = name;
+    }
+
+    // Выгрузка всех потоков. Вызывается, когда рабочие потоки не пишут события (например, в конце кадра)
+    static bool writeChromeTrace(const std::string& path)
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            std::cout << "ERROR::PROFILER::CANNOT_WRITE " << path << std::endl;
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+        uint64_t origin = UINT64_MAX;
+        for (auto& buffer : registry())
+        {
+            uint64_t head = buffer->head.load(std::memory_order_acquire);
+            uint64_t first = head > CAPACITY ? head - CAPACITY : 0;
+            for (uint64_t i = first; i < head; i++)
+                origin = std::min(origin, buffer->events[i & (CAPACITY - 1)].start);
+        }
+
+        file << "{\"traceEvents\":[\n";
+        file << std::fixed << std::setprecision(3);
+        bool firstEvent = true;
+        for (auto& buffer : registry())
+        {
+            file << (firstEvent ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->tid
+                 << ",\"args\":{\"name\":\"" << buffer->name << "\"}}";
+            firstEvent = false;
+
+            uint64_t head = buffer->head.load(std::memory_order_acquire);
+            uint64_t first = head > CAPACITY ? head - CAPACITY : 0;
+            for (uint64_t i = first; i < head; i++)
+            {
+                const Event& e = buffer->events[i & (CAPACITY - 1)];
+                file << ",\n{\"name\":\"" << e.name << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->tid
+                     << ",\"ts\":" << (e.start - origin) / 1.0e3 << ",\"dur\":" << (e.end - e.start) / 1.0e3 << "}";
+            }
+        }
+        file << "\n]}\n";
+        return true;
+    }
+
+    // RAII-замер участка кода
+    class Scope
+    {
+    public:
+        explicit Scope(const char* name) : name(name), start(now()) {}
+        ~Scope() { record(name, start, now()); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        const char* name;
+        uint64_t start;
+    };
+
+private:
+    static std::mutex& registryMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<std::unique_ptr<ThreadBuffer>>& registry()
+    {
+        static std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        return buffers;
+    }
+
+    // Буфер создается при первом событии потока; блокировка берется только в этот момент.
+    // Буферы живут до конца программы, чтобы события завершившихся потоков попали в выгрузку
+    static ThreadBuffer& threadBuffer()
+    {
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer)
+        {
+            std::lock_guard<std::mutex> lock(registryMutex());
+            std::unique_ptr<ThreadBuffer> created(new ThreadBuffer());
+            created->events.resize(CAPACITY);
+            created->tid = (uint32_t)registry().size();
+            created->name = created->tid == 0 ? "main" : "worker " + std::to_string(created->tid);
+            buffer = created.get();
+            registry().push_back(std::move(created));
+        }
+        return *buffer;
+    }
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) Profiler::Scope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_THREAD_NAME(name) Profiler::setThreadName(name)
+#define PROFILE_DUMP(path) Profiler::writeChromeTrace(path)
+
+#else
+
+#define PROFILE_SCOPE(name)
+#define PROFILE_THREAD_NAME(name)
+#define PROFILE_DUMP(path)
+
+#endif
+#endif
@@ -0,0 +1,27 @@
+#ifndef RENDER_STATS_H
+#define RENDER_STATS_H
+
+// Счетчики команд рисования за кадр. Обнуляются в начале кадра и читаются бенчмарками и оверлеями
+struct RenderStats {
+    unsigned int drawCalls = 0;
+    unsigned long long triangles = 0;
+
+    void reset()
+    {
+        drawCalls = 0;
+        triangles = 0;
+    }
+
+    void draw(unsigned long long triangleCount, unsigned int instances = 1)
+    {
+        drawCalls++;
+        triangles += triangleCount * instances;
+    }
+};
+
+inline RenderStats& renderStats()
+{
+    static RenderStats stats;
+    return stats;
+}
+#endif
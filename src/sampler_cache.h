@@ -0,0 +1,131 @@
+#ifndef SAMPLER_CACHE_H
+#define SAMPLER_CACHE_H
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// Анизотропная фильтрация (GL_EXT_texture_filter_anisotropic, в ядре только с OpenGL 4.6) отсутствует в glad
+#ifndef GL_TEXTURE_MAX_ANISOTROPY_EXT
+#define GL_TEXTURE_MAX_ANISOTROPY_EXT 0x84FE
+#endif
+#ifndef GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
+#define GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT 0x84FF
+#endif
+
+// Поддерживает ли контекст расширение name
+inline bool hasGlExtension(const char* name)
+{
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++)
+    {
+        const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+        if (extension && std::strcmp(extension, name) == 0)
+            return true;
+    }
+    return false;
+}
+
+// Общие объекты сэмплеров. Состояние выборки (повторение, фильтрация, анизотропия) хранится не в каждой
+// текстуре, а в нескольких сэмплерах, которые привязываются к текстурным юнитам вместе с текстурами
+// (glBindSampler заменяет параметры самой текстуры). Поэтому степень анизотропной фильтрации -
+// одна настройка для всех текстур, и её можно менять во время работы
+class SamplerCache
+{
+public:
+    enum Filter {
+        Nearest,   // без интерполяции и мип-уровней
+        Linear,    // билинейная, без мип-уровней
+        Trilinear, // между мип-уровнями, с анизотропией
+    };
+
+    static constexpr float DEFAULT_ANISOTROPY = 8.0f;
+
+    // Сэмплер с заданными повторением и фильтрацией; создается при первом запросе
+    unsigned int get(GLenum wrap = GL_REPEAT, Filter filter = Trilinear)
+    {
+        for (const Sampler& sampler : samplers)
+            if (sampler.wrap == wrap && sampler.filter == filter)
+                return sampler.id;
+
+        if (!queried)
+            queryLimits();
+        Sampler sampler = { wrap, filter, 0 };
+        glGenSamplers(1, &sampler.id);
+        glSamplerParameteri(sampler.id, GL_TEXTURE_WRAP_S, wrap);
+        glSamplerParameteri(sampler.id, GL_TEXTURE_WRAP_T, wrap);
+        glSamplerParameteri(sampler.id, GL_TEXTURE_MIN_FILTER, filter == Trilinear ? GL_LINEAR_MIPMAP_LINEAR : filter == Linear ? GL_LINEAR : GL_NEAREST);
+        glSamplerParameteri(sampler.id, GL_TEXTURE_MAG_FILTER, filter == Nearest ? GL_NEAREST : GL_LINEAR);
+        samplers.push_back(sampler);
+        applyAnisotropy(sampler);
+        return sampler.id;
+    }
+
+    // Привязка сэмплера к текстурному юниту unit (номер юнита, а не GL_TEXTURE0 + unit)
+    void bind(unsigned int unit, GLenum wrap = GL_REPEAT, Filter filter = Trilinear)
+    {
+        glBindSampler(unit, get(wrap, filter));
+    }
+
+    // Степень анизотропной фильтрации трилинейных сэмплеров: 1 - выключена. Ограничивается максимумом
+    // драйвера; без расширения настройка ни на что не влияет
+    void setAnisotropy(float level)
+    {
+        if (!queried)
+            queryLimits();
+        anisotropy = std::max(1.0f, std::min(level, maxAnisotropy));
+        for (const Sampler& sampler : samplers)
+            applyAnisotropy(sampler);
+    }
+
+    float getAnisotropy() const { return anisotropy; }
+    bool anisotropySupported() const { return maxAnisotropy > 1.0f; }
+
+    // Удаление сэмплеров (до уничтожения контекста OpenGL)
+    void release()
+    {
+        for (const Sampler& sampler : samplers)
+            glDeleteSamplers(1, &sampler.id);
+        samplers.clear();
+    }
+
+private:
+    struct Sampler {
+        GLenum wrap;
+        Filter filter;
+        unsigned int id;
+    };
+
+    std::vector<Sampler> samplers; // сэмплеров немного, поиск линейный
+    float anisotropy = DEFAULT_ANISOTROPY;
+    float maxAnisotropy = 1.0f;
+    bool queried = false;
+
+    void queryLimits()
+    {
+        queried = true;
+        if (hasGlExtension("GL_EXT_texture_filter_anisotropic") || hasGlExtension("GL_ARB_texture_filter_anisotropic"))
+            glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
+        else
+            std::cout << "Anisotropic filtering is not supported" << std::endl;
+        anisotropy = std::max(1.0f, std::min(anisotropy, maxAnisotropy));
+    }
+
+    void applyAnisotropy(const Sampler& sampler) const
+    {
+        if (anisotropySupported() && sampler.filter == Trilinear)
+            glSamplerParameterf(sampler.id, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
+    }
+};
+
+// Сэмплеры процесса
+inline SamplerCache& samplerCache()
+{
+    static SamplerCache cache;
+    return cache;
+}
+#endif
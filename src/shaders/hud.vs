@@ -0,0 +1,14 @@
+#version 330 core
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec2 aTexCoords;
+layout (location = 2) in vec4 aColor;
+
+out vec2 TexCoords;
+out vec4 Color;
+
+void main()
+{
+	TexCoords = aTexCoords;
+	Color = aColor;
+	gl_Position = vec4(aPos, 0.0, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#version 330 core
+// Сжатые вершины (PackedVertex, см. vertex.h) с матрицей модели из атрибутов экземпляра
+layout (location = 0) in vec4 aPos;     // позиция в [0, 1] внутри параллелепипеда модели, w - знак бинормали
+layout (location = 1) in vec2 aNormal;  // октаэдрически закодированная нормаль
+layout (location = 2) in vec2 aTexCoords;
+layout (location = 3) in vec2 aTangent; // октаэдрически закодированный касательный вектор
+layout (location = 5) in mat4 aInstanceModel; // матрица модели экземпляра (атрибуты 5-8, см. instancing.h)
+
+out vec2 TexCoords;
+out mat3 TBN; // касательное пространство в координатах модели
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec3 positionOffset;
+uniform vec3 positionScale;
+
+vec3 octDecode(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+    return normalize(n);
+}
+
+void main()
+{
+    vec3 position = positionOffset + aPos.xyz * positionScale;
+    vec3 normal = octDecode(aNormal);
+    vec3 tangent = octDecode(aTangent);
+    TBN = mat3(tangent, cross(normal, tangent) * (aPos.w * 2.0 - 1.0), normal);
+    TexCoords = aTexCoords;
+    gl_Position = projection * view * aInstanceModel * vec4(position, 1.0);
+}
@@ -0,0 +1,31 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoords;
+layout (location = 5) in mat4 aInstanceModel; // матрица модели экземпляра (атрибуты 5-8, см. instancing.h)
+layout (location = 9) in uvec4 aBoneIds;      // индексы костей (см. vertex.h)
+layout (location = 10) in vec4 aBoneWeights;  // веса костей, в сумме 1 (или 0 у вершин без костей)
+
+out vec2 TexCoords;
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform samplerBuffer bonePalette; // палитры костей экземпляров подряд, по четыре текселя на матрицу
+uniform int boneCount;
+
+mat4 boneMatrix(uint bone)
+{
+    int base = (gl_InstanceID * boneCount + int(bone)) * 4;
+    return mat4(texelFetch(bonePalette, base), texelFetch(bonePalette, base + 1),
+                texelFetch(bonePalette, base + 2), texelFetch(bonePalette, base + 3));
+}
+
+void main()
+{
+    mat4 skin = mat4(1.0);
+    if (aBoneWeights.x + aBoneWeights.y + aBoneWeights.z + aBoneWeights.w > 0.0)
+        skin = boneMatrix(aBoneIds.x) * aBoneWeights.x + boneMatrix(aBoneIds.y) * aBoneWeights.y
+             + boneMatrix(aBoneIds.z) * aBoneWeights.z + boneMatrix(aBoneIds.w) * aBoneWeights.w;
+    TexCoords = aTexCoords;
+    gl_Position = projection * view * aInstanceModel * skin * vec4(aPos, 1.0);
+}
@@ -1,7 +1,9 @@
 #version 330 core
 out vec4 FragColor;
 
+uniform vec4 color;
+
 void main()
 {
-	FragColor = vec4(0.5);
+	FragColor = color;
 }
\ No newline at end of file
@@ -0,0 +1,9 @@
+#version 330 core
+layout (location = 0) in vec2 aPos;
+
+uniform vec4 rect; // x, y, ширина, высота в NDC
+
+void main()
+{
+	gl_Position = vec4(rect.xy + aPos * rect.zw, 0.0, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,278 @@
+#ifndef SIMPLIFY_H
+#define SIMPLIFY_H
+
+#include "vertex.h"
+#include "mesh_optimizer.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Упрощение меша стягиванием ребер с метрикой квадрик ошибки (Garland-Heckbert).
+// Вершина стягивается в одну из соседних вершин (а не в новую точку), поэтому упрощенный меш - это только
+// новый массив индексов, ссылающийся на исходные вершины: уровни детализации делят один вершинный буфер.
+// Вершины с одинаковыми атрибутами сначала сливаются (импорт OBJ дает отдельную вершину каждому углу
+// треугольника, и без слияния весь меш выглядел бы набором швов и границ). Вершины на открытых границах и
+// на швах атрибутов (несколько вершин в одной позиции с разными нормалями или UV) не двигаются, чтобы
+// в меше не появлялись дыры и разрывы текстур
+namespace Simplify
+{
+    // Симметричная матрица 4x4 квадрики: сумма квадратов расстояний до плоскостей треугольников
+    struct Quadric {
+        double a00 = 0, a01 = 0, a02 = 0, a03 = 0;
+        double a11 = 0, a12 = 0, a13 = 0;
+        double a22 = 0, a23 = 0;
+        double a33 = 0;
+        double weight = 0; // суммарный вес плоскостей, ошибка нормируется на него
+
+        static Quadric plane(const glm::dvec3& n, double d, double weight)
+        {
+            Quadric q;
+            q.a00 = n.x * n.x * weight; q.a01 = n.x * n.y * weight; q.a02 = n.x * n.z * weight; q.a03 = n.x * d * weight;
+            q.a11 = n.y * n.y * weight; q.a12 = n.y * n.z * weight; q.a13 = n.y * d * weight;
+            q.a22 = n.z * n.z * weight; q.a23 = n.z * d * weight;
+            q.a33 = d * d * weight;
+            q.weight = weight;
+            return q;
+        }
+
+        Quadric& operator+=(const Quadric& q)
+        {
+            a00 += q.a00; a01 += q.a01; a02 += q.a02; a03 += q.a03;
+            a11 += q.a11; a12 += q.a12; a13 += q.a13;
+            a22 += q.a22; a23 += q.a23;
+            a33 += q.a33;
+            weight += q.weight;
+            return *this;
+        }
+
+        // Средний квадрат расстояния до плоскостей: v^T Q v / weight для v = (p, 1)
+        double error(const glm::vec3& p) const
+        {
+            double x = p.x, y = p.y, z = p.z;
+            double e = a00 * x * x + 2 * a01 * x * y + 2 * a02 * x * z + 2 * a03 * x
+                     + a11 * y * y + 2 * a12 * y * z + 2 * a13 * y
+                     + a22 * z * z + 2 * a23 * z
+                     + a33;
+            return e > 0.0 && weight > 0.0 ? e / weight : 0.0;
+        }
+    };
+
+    // Упрощение до targetIndexCount индексов (или меньше), пока ошибка не превышает maxError.
+    // maxError задается относительно диагонали ограничивающего параллелепипеда меша; достигнутая ошибка
+    // (в тех же единицах) записывается в resultError. Возвращает новые индексы для тех же вершин
+    inline std::vector<unsigned int> simplify(const Vertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount,
+                                              size_t targetIndexCount, float maxError, float* resultError = nullptr)
+    {
+        std::vector<unsigned int> result(indices, indices + indexCount);
+        if (resultError)
+            *resultError = 0.0f;
+        if (indexCount <= targetIndexCount || vertexCount == 0)
+            return result;
+
+        glm::vec3 boundsMin = vertices[0].Position, boundsMax = vertices[0].Position;
+        for (size_t i = 1; i < vertexCount; i++)
+        {
+            boundsMin = glm::min(boundsMin, vertices[i].Position);
+            boundsMax = glm::max(boundsMax, vertices[i].Position);
+        }
+        double extent = glm::length(glm::dvec3(boundsMax - boundsMin));
+        if (extent <= 0.0)
+            return result;
+        double maxErrorSquared = (double)maxError * maxError * extent * extent;
+
+        // Слияние одинаковых вершин: индексы переписываются на первую из них (она остается в исходном массиве,
+        // так что результат по-прежнему ссылается на те же вершины)
+        std::vector<unsigned char> canonical(vertexCount, 0);
+        {
+            std::unordered_map<Vertex, unsigned int, MeshOptimizer::VertexHash, MeshOptimizer::VertexEqual> first;
+            first.reserve(vertexCount);
+            std::vector<unsigned int> weld(vertexCount);
+            for (unsigned int v = 0; v < vertexCount; v++)
+            {
+                auto inserted = first.insert(std::make_pair(vertices[v], v));
+                weld[v] = inserted.first->second;
+                canonical[v] = inserted.second;
+            }
+            for (unsigned int& index : result)
+                index = weld[index];
+        }
+
+        // Швы: несколько разных вершин с одной и той же позицией
+        std::vector<unsigned char> locked(vertexCount, 0);
+        {
+            struct PositionHash {
+                size_t operator()(const glm::vec3& p) const
+                {
+                    uint32_t bits[3];
+                    std::memcpy(bits, &p, sizeof(bits));
+                    return (size_t)(bits[0] * 73856093u ^ bits[1] * 19349663u ^ bits[2] * 83492791u);
+                }
+            };
+            std::unordered_map<glm::vec3, unsigned int, PositionHash> firstVertex;
+            firstVertex.reserve(vertexCount);
+            for (unsigned int v = 0; v < vertexCount; v++)
+            {
+                if (!canonical[v])
+                    continue;
+                auto inserted = firstVertex.insert(std::make_pair(vertices[v].Position, v));
+                if (!inserted.second)
+                    locked[v] = locked[inserted.first->second] = 1;
+            }
+        }
+
+        // Открытые границы: ребро (a, b) без парного ребра (b, a)
+        {
+            std::unordered_set<uint64_t> edges;
+            edges.reserve(indexCount);
+            for (size_t i = 0; i < indexCount; i += 3)
+                for (int e = 0; e < 3; e++)
+                    edges.insert((uint64_t)result[i + e] << 32 | result[i + (e + 1) % 3]);
+            for (size_t i = 0; i < indexCount; i += 3)
+            {
+                for (int e = 0; e < 3; e++)
+                {
+                    unsigned int a = result[i + e], b = result[i + (e + 1) % 3];
+                    if (!edges.count((uint64_t)b << 32 | a))
+                        locked[a] = locked[b] = 1;
+                }
+            }
+        }
+
+        // Квадрики вершин: плоскости прилегающих треугольников с весом, равным площади
+        std::vector<Quadric> quadrics(vertexCount);
+        for (size_t i = 0; i < indexCount; i += 3)
+        {
+            glm::dvec3 p0 = vertices[result[i]].Position, p1 = vertices[result[i + 1]].Position, p2 = vertices[result[i + 2]].Position;
+            glm::dvec3 n = glm::cross(p1 - p0, p2 - p0);
+            double area = glm::length(n);
+            if (area <= 0.0)
+                continue;
+            n /= area;
+            Quadric q = Quadric::plane(n, -glm::dot(n, p0), area * 0.5);
+            for (int k = 0; k < 3; k++)
+                quadrics[result[i + k]] += q;
+        }
+
+        struct Collapse {
+            unsigned int from, to;
+            double cost;
+        };
+        std::vector<Collapse> collapses;
+        std::vector<unsigned int> adjacencyOffsets, adjacency, remap(vertexCount);
+        std::vector<unsigned char> touched(vertexCount);
+        double worstError = 0.0;
+
+        while (result.size() > targetIndexCount)
+        {
+            size_t triangleCount = result.size() / 3;
+
+            // Треугольники при каждой вершине
+            adjacencyOffsets.assign(vertexCount + 1, 0);
+            for (unsigned int index : result)
+                adjacencyOffsets[index + 1]++;
+            for (size_t v = 0; v < vertexCount; v++)
+                adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+            adjacency.resize(result.size());
+            {
+                std::vector<unsigned int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                for (size_t t = 0; t < triangleCount; t++)
+                    for (int k = 0; k < 3; k++)
+                        adjacency[fill[result[t * 3 + k]]++] = (unsigned int)t;
+            }
+
+            // Кандидаты на стягивание, от самых дешевых
+            collapses.clear();
+            for (size_t t = 0; t < triangleCount; t++)
+            {
+                for (int e = 0; e < 3; e++)
+                {
+                    unsigned int a = result[t * 3 + e], b = result[t * 3 + (e + 1) % 3];
+                    Quadric q = quadrics[a];
+                    q += quadrics[b];
+                    if (!locked[a])
+                        collapses.push_back({ a, b, q.error(vertices[b].Position) });
+                    if (!locked[b])
+                        collapses.push_back({ b, a, q.error(vertices[a].Position) });
+                }
+            }
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& x, const Collapse& y) { return x.cost < y.cost; });
+
+            // Независимые стягивания за один проход: окрестности стягиваемых вершин не пересекаются,
+            // поэтому проверка переворота треугольников остается верной для всех стягиваний прохода
+            for (unsigned int v = 0; v < vertexCount; v++)
+                remap[v] = v;
+            std::fill(touched.begin(), touched.end(), 0);
+            size_t trianglesToRemove = (result.size() - targetIndexCount + 2) / 3;
+            size_t removed = 0, applied = 0;
+            for (const Collapse& collapse : collapses)
+            {
+                if (collapse.cost > maxErrorSquared || removed >= trianglesToRemove)
+                    break;
+                unsigned int a = collapse.from, b = collapse.to;
+                if (touched[a] || touched[b])
+                    continue;
+
+                // Треугольники при a после перемещения a в позицию b не должны перевернуться
+                bool flips = false;
+                size_t shared = 0;
+                for (unsigned int j = adjacencyOffsets[a]; j < adjacencyOffsets[a + 1] && !flips; j++)
+                {
+                    const unsigned int* tri = &result[adjacency[j] * 3];
+                    if (tri[0] == b || tri[1] == b || tri[2] == b)
+                    {
+                        shared++;
+                        continue;
+                    }
+                    glm::vec3 p[3], q[3];
+                    for (int k = 0; k < 3; k++)
+                    {
+                        p[k] = vertices[tri[k]].Position;
+                        q[k] = tri[k] == a ? vertices[b].Position : p[k];
+                    }
+                    glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+                    glm::vec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+                    if (glm::dot(before, after) <= 0.0f)
+                        flips = true;
+                }
+                if (flips || shared == 0)
+                    continue;
+
+                remap[a] = b;
+                quadrics[b] += quadrics[a];
+                for (unsigned int j = adjacencyOffsets[a]; j < adjacencyOffsets[a + 1]; j++)
+                    for (int k = 0; k < 3; k++)
+                        touched[result[adjacency[j] * 3 + k]] = 1;
+                removed += shared;
+                applied++;
+                worstError = std::max(worstError, collapse.cost);
+            }
+            if (applied == 0)
+                break;
+
+            // Перестраиваем индексы и удаляем вырожденные треугольники
+            size_t write = 0;
+            for (size_t i = 0; i < result.size(); i += 3)
+            {
+                unsigned int a = remap[result[i]], b = remap[result[i + 1]], c = remap[result[i + 2]];
+                if (a == b || b == c || a == c)
+                    continue;
+                result[write++] = a;
+                result[write++] = b;
+                result[write++] = c;
+            }
+            result.resize(write);
+        }
+
+        if (resultError)
+            *resultError = (float)(std::sqrt(worstError) / extent);
+        return result;
+    }
+}
+#endif
@@ -0,0 +1,296 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "image_loader.h"
+#include "mipmap.h"
+#include "gpu_resources.h"
+#include "profiler.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Упаковка прямоугольников в страницу фиксированного размера методом skyline (bottom-left):
+// верхняя граница занятой области хранится ломаной из горизонтальных отрезков, и прямоугольник ставится
+// туда, где он окажется ниже всего (при равенстве - левее). Для набора мелких изображений, добавляемых
+// по мере загрузки, дает плотность, близкую к MaxRects, при O(число отрезков) на вставку
+class SkylinePacker
+{
+public:
+    explicit SkylinePacker(int width = 0, int height = 0) : width(width), height(height)
+    {
+        if (width > 0)
+            skyline.push_back({ 0, 0, width });
+    }
+
+    // Место для прямоугольника w x h: левый нижний угол в (x, y). false, если страница заполнена
+    bool insert(int w, int h, int& x, int& y)
+    {
+        int bestY = INT_MAX, bestX = INT_MAX;
+        size_t best = skyline.size();
+        for (size_t i = 0; i < skyline.size(); i++)
+        {
+            int top;
+            if (!fits(i, w, h, top))
+                continue;
+            if (top < bestY || (top == bestY && skyline[i].x < bestX))
+            {
+                bestY = top;
+                bestX = skyline[i].x;
+                best = i;
+            }
+        }
+        if (best == skyline.size())
+            return false;
+
+        x = bestX;
+        y = bestY;
+        // Новый отрезок над прямоугольником; отрезки, которые он перекрывает, укорачиваются или удаляются
+        skyline.insert(skyline.begin() + best, { x, y + h, w });
+        for (size_t i = best + 1; i < skyline.size();)
+        {
+            Segment& segment = skyline[i];
+            int overlap = x + w - segment.x;
+            if (overlap <= 0)
+                break;
+            if (overlap < segment.width)
+            {
+                segment.x += overlap;
+                segment.width -= overlap;
+                break;
+            }
+            skyline.erase(skyline.begin() + i);
+        }
+        // Соседние отрезки одной высоты объединяются
+        for (size_t i = 0; i + 1 < skyline.size();)
+        {
+            if (skyline[i].y == skyline[i + 1].y)
+            {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + i + 1);
+            }
+            else
+                i++;
+        }
+        usedArea += (size_t)w * h;
+        return true;
+    }
+
+    // Доля занятой площади
+    float occupancy() const { return width > 0 ? (float)usedArea / ((size_t)width * height) : 0.0f; }
+
+private:
+    struct Segment {
+        int x, y, width;
+    };
+
+    int width, height;
+    std::vector<Segment> skyline; // слева направо, без промежутков
+    size_t usedArea = 0;
+
+    // Помещается ли прямоугольник, начиная с отрезка index; top - высота его нижней грани
+    bool fits(size_t index, int w, int h, int& top) const
+    {
+        int x = skyline[index].x;
+        if (x + w > width)
+            return false;
+        top = 0;
+        for (size_t i = index; i < skyline.size() && skyline[i].x < x + w; i++)
+        {
+            top = std::max(top, skyline[i].y);
+            if (top + h > height)
+                return false;
+        }
+        return true;
+    }
+};
+
+// Атлас мелких изображений (значки интерфейса, спрайты): изображения упаковываются в общие текстуры
+// PAGE_SIZE x PAGE_SIZE, и все, что лежит на одной странице, рисуется без переключения текстур (см. hud.h).
+// Вызывающий получает номер страницы и прямоугольник текстурных координат.
+// Вокруг каждого изображения оставляется поле PADDING, заполненное его крайними пикселями, а места
+// выровнены на PADDING, поэтому на мип-уровнях до MIP_LEVELS соседние изображения не смешиваются
+class TextureAtlas
+{
+public:
+    static const int PAGE_SIZE = 2048;
+    static const int MIP_LEVELS = 3;                // мип-уровни сверх основного
+    static const int PADDING = 1 << MIP_LEVELS;     // 8 пикселей с каждой стороны
+    static const int MAX_IMAGE_SIZE = 256;          // более крупные изображения уменьшаются при добавлении
+
+    struct Region {
+        int page = -1;
+        glm::vec4 uv = glm::vec4(0.0f); // u0, v0, u1, v1 (v0 - нижний край)
+        int width = 0, height = 0;      // размер в атласе, в пикселях
+
+        bool valid() const { return page >= 0; }
+    };
+
+    // srgb - изображения хранятся как цветовые карты в sRGB (при sRGB-фреймбуфере, см. Window::srgb)
+    explicit TextureAtlas(bool srgb = true) : srgb(srgb) {}
+
+    // Пакетное добавление: файлы декодируются параллельно, упаковываются от высоких к низким и загружаются
+    // в страницы вместе со своими мип-уровнями (mipmap.h). Изображения крупнее maxSize
+    // уменьшаются вдвое, пока не поместятся. Области возвращаются в порядке путей; у незагруженных page = -1
+    std::vector<Region> add(const std::vector<std::string>& paths, int maxSize = MAX_IMAGE_SIZE)
+    {
+        PROFILE_SCOPE("add atlas images");
+        std::vector<ImageLoader::Image> images(paths.size());
+        for (size_t i = 0; i < paths.size(); i++)
+            images[i].path = paths[i];
+        ImageLoader::decodeBatch(images);
+
+        std::vector<Mipmap::Level> levels(images.size());
+        for (size_t i = 0; i < images.size(); i++)
+        {
+            if (!images[i].pixels)
+            {
+                std::cout << "ERROR::TEXTURE_ATLAS::CANNOT_LOAD " << images[i].path << std::endl;
+                continue;
+            }
+            levels[i] = toRgba(images[i]);
+            images[i].release();
+            Mipmap::Options options;
+            options.srgb = srgb;
+            options.preserveCoverage = Mipmap::isCutout(levels[i]);
+            while (std::max(levels[i].width, levels[i].height) > maxSize)
+                levels[i] = Mipmap::downsample(levels[i], options);
+        }
+
+        std::vector<size_t> order(images.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return levels[a].height > levels[b].height; });
+
+        std::vector<Region> regions(images.size());
+        for (size_t i : order)
+            if (!levels[i].pixels.empty())
+                regions[i] = place(levels[i]);
+        return regions;
+    }
+
+    Region add(const std::string& path, int maxSize = MAX_IMAGE_SIZE)
+    {
+        return add(std::vector<std::string>{ path }, maxSize)[0];
+    }
+
+    unsigned int pageTexture(int page) const { return pages[page].id; }
+    size_t pageCount() const { return pages.size(); }
+    float occupancy(int page) const { return pages[page].packer.occupancy(); }
+
+    // Удаление страниц (до уничтожения контекста OpenGL)
+    void release()
+    {
+        for (const Page& page : pages)
+        {
+            gpuResources().remove(GpuResources::Texture, page.id);
+            glDeleteTextures(1, &page.id);
+        }
+        pages.clear();
+    }
+
+private:
+    struct Page {
+        unsigned int id;
+        SkylinePacker packer;
+    };
+
+    std::vector<Page> pages;
+    bool srgb;
+
+    // Изображение с любым числом каналов в RGBA8 (одноканальные - оттенки серого)
+    static Mipmap::Level toRgba(const ImageLoader::Image& image)
+    {
+        Mipmap::Level level;
+        level.width = image.width;
+        level.height = image.height;
+        level.pixels.resize((size_t)image.width * image.height * 4);
+        for (size_t i = 0; i < (size_t)image.width * image.height; i++)
+        {
+            const unsigned char* source = image.pixels + i * image.components;
+            unsigned char* target = &level.pixels[i * 4];
+            bool color = image.components >= 3;
+            target[0] = source[0];
+            target[1] = source[color ? 1 : 0];
+            target[2] = source[color ? 2 : 0];
+            target[3] = image.components == 4 ? source[3] : image.components == 2 ? source[1] : 255;
+        }
+        return level;
+    }
+
+    static int alignUp(int value) { return (value + PADDING - 1) / PADDING * PADDING; }
+
+    // Место на первой странице, где оно есть; при необходимости создается новая страница
+    Region place(const Mipmap::Level& image)
+    {
+        int w = alignUp(image.width + 2 * PADDING), h = alignUp(image.height + 2 * PADDING);
+        if (w > PAGE_SIZE || h > PAGE_SIZE)
+            return Region();
+        int x = 0, y = 0;
+        size_t page = 0;
+        while (page < pages.size() && !pages[page].packer.insert(w, h, x, y))
+            page++;
+        if (page == pages.size())
+        {
+            addPage();
+            pages.back().packer.insert(w, h, x, y);
+        }
+
+        // Изображение с полем из крайних пикселей. Мип-уровни строятся только для него (box-фильтр
+        // не выходит за поле), так что остальная страница не пересчитывается
+        Mipmap::Level padded = { w, h, std::vector<unsigned char>((size_t)w * h * 4) };
+        for (int py = 0; py < h; py++)
+        {
+            int sy = std::min(std::max(py - PADDING, 0), image.height - 1);
+            for (int px = 0; px < w; px++)
+            {
+                int sx = std::min(std::max(px - PADDING, 0), image.width - 1);
+                std::copy_n(&image.pixels[((size_t)sy * image.width + sx) * 4], 4, &padded.pixels[((size_t)py * w + px) * 4]);
+            }
+        }
+        Mipmap::Options options;
+        options.srgb = srgb;
+        options.preserveCoverage = Mipmap::isCutout(padded);
+        std::vector<Mipmap::Level> levels = Mipmap::generateChain(std::move(padded), options);
+        glBindTexture(GL_TEXTURE_2D, pages[page].id);
+        for (int level = 0; level <= MIP_LEVELS; level++)
+            glTexSubImage2D(GL_TEXTURE_2D, level, x >> level, y >> level, levels[level].width, levels[level].height,
+                            GL_RGBA, GL_UNSIGNED_BYTE, levels[level].pixels.data());
+
+        Region region;
+        region.page = (int)page;
+        region.width = image.width;
+        region.height = image.height;
+        region.uv = glm::vec4(x + PADDING, y + PADDING, x + PADDING + image.width, y + PADDING + image.height) / (float)PAGE_SIZE;
+        return region;
+    }
+
+    void addPage()
+    {
+        Page page = { 0, SkylinePacker(PAGE_SIZE, PAGE_SIZE) };
+        glGenTextures(1, &page.id);
+        glBindTexture(GL_TEXTURE_2D, page.id);
+        GLenum internalFormat = srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+        for (int level = 0; level <= MIP_LEVELS; level++)
+            glTexImage2D(GL_TEXTURE_2D, level, internalFormat, PAGE_SIZE >> level, PAGE_SIZE >> level, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, MIP_LEVELS);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        size_t bytes = 0;
+        for (int level = 0; level <= MIP_LEVELS; level++)
+            bytes += (size_t)(PAGE_SIZE >> level) * (PAGE_SIZE >> level) * 4;
+        gpuResources().add(GpuResources::Texture, page.id, "texture atlas");
+        gpuResources().setTexture(page.id, PAGE_SIZE, PAGE_SIZE, internalFormat, MIP_LEVELS + 1, bytes);
+        pages.push_back(page);
+    }
+};
+#endif
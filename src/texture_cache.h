@@ -0,0 +1,458 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <glad/glad.h>
+
+#include "image_loader.h"
+#include "ktx2.h"
+#include "mipmap.h"
+#include "texture_streamer.h"
+#include "sampler_cache.h"
+#include "gpu_resources.h"
+#include "mapped_file.h"
+#include "profiler.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Форматы S3TC (BC1-BC3) не входят в ядро OpenGL 3.3 и в сгенерированный glad
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+// Параметры загрузки, от которых зависит содержимое текстуры (входят в ключ кэша)
+struct TextureParams {
+    bool srgb = false;       // цветовая карта в пространстве sRGB
+    bool flip = true;        // переворот по вертикали (OpenGL ожидает первую строку снизу)
+    GLenum wrap = GL_REPEAT;
+    bool stream = false;     // крупные мип-уровни запеченной текстуры подгружаются по запросу (texture_streamer.h)
+
+    bool operator==(const TextureParams& other) const
+    {
+        return srgb == other.srgb && flip == other.flip && wrap == other.wrap && stream == other.stream;
+    }
+};
+
+// Запрос текстуры для пакетной загрузки
+struct TextureRequest {
+    std::string path;
+    TextureParams params;
+};
+
+// Общий для всего процесса кэш текстур. Текстура ищется по нормализованному пути и параметрам загрузки
+// (хэш-таблица, O(1)), поэтому одинаковые текстуры разных моделей загружаются один раз.
+// Владельцы получают Handle со счетчиком ссылок. Текстура без ссылок остается в кэше для повторного
+// использования и удаляется (начиная с давно освобожденных, LRU), только когда объем видеопамяти
+// всех текстур превышает бюджет
+class TextureCache
+{
+    struct Entry;
+
+public:
+    // Ссылка на текстуру в кэше; копирование увеличивает счетчик ссылок, уничтожение - уменьшает
+    class Handle
+    {
+    public:
+        Handle() {}
+        Handle(const Handle& other) : cache(other.cache), entry(other.entry) { addRef(); }
+        Handle(Handle&& other) noexcept : cache(other.cache), entry(other.entry) { other.entry = nullptr; }
+        ~Handle() { reset(); }
+
+        Handle& operator=(Handle other)
+        {
+            std::swap(cache, other.cache);
+            std::swap(entry, other.entry);
+            return *this;
+        }
+
+        unsigned int id() const { return entry ? entry->id : 0; }
+        explicit operator bool() const { return entry != nullptr; }
+
+        void reset()
+        {
+            if (entry)
+                cache->releaseRef(entry);
+            entry = nullptr;
+        }
+
+    private:
+        friend class TextureCache;
+        TextureCache* cache = nullptr;
+        Entry* entry = nullptr;
+
+        Handle(TextureCache* cache, Entry* entry) : cache(cache), entry(entry) { addRef(); }
+
+        void addRef()
+        {
+            if (entry)
+                cache->addRef(entry);
+        }
+    };
+
+    explicit TextureCache(size_t budgetBytes = DEFAULT_BUDGET) : budget(budgetBytes) {}
+
+    // Текстура из файла path. Если файл не загрузился, возвращается ссылка на пустую текстуру (как и раньше,
+    // с сообщением в консоль), чтобы повторные запросы не читали файл снова
+    Handle acquire(const std::string& path, const TextureParams& params = TextureParams())
+    {
+        return acquire(std::vector<TextureRequest>{ { path, params } })[0];
+    }
+
+    // Пакетная загрузка: файлы, которых нет в кэше (и нет их запеченных версий), декодируются
+    // параллельно в пуле потоков, затем текстуры создаются в вызывающем потоке с контекстом OpenGL.
+    // Ссылки возвращаются в порядке запросов
+    std::vector<Handle> acquire(const std::vector<TextureRequest>& requests)
+    {
+        PROFILE_SCOPE("acquire textures");
+        std::vector<Handle> handles;
+        handles.reserve(requests.size());
+        std::vector<ImageLoader::Image> images;
+        std::vector<Entry*> decoded;
+        for (const TextureRequest& request : requests)
+        {
+            Key key = { normalizePath(request.path), request.params };
+            key.params.srgb = key.params.srgb && srgbEnabled;
+            auto found = entries.find(key);
+            if (found == entries.end())
+            {
+                found = entries.emplace(key, Entry()).first;
+                Entry& entry = found->second;
+                entry.key = &found->first;
+                entry.lru = unused.end();
+                glGenTextures(1, &entry.id);
+                gpuResources().add(GpuResources::Texture, entry.id, key.path);
+                if (!uploadCompressed(entry.id, key.path, key.params, entry.bytes))
+                {
+                    ImageLoader::Image image;
+                    image.path = key.path;
+                    image.flip = key.params.flip;
+                    images.push_back(image);
+                    decoded.push_back(&entry);
+                }
+                usage += entry.bytes;
+            }
+            // Ссылка берется сразу, чтобы новые текстуры пакета не вытеснялись до его окончания
+            handles.push_back(Handle(this, &found->second));
+        }
+
+        if (!images.empty())
+        {
+            ImageLoader::BatchStatistics statistics = ImageLoader::decodeBatch(images);
+            if (images.size() > 1)
+                ImageLoader::report(statistics);
+            for (size_t i = 0; i < images.size(); i++)
+            {
+                upload(decoded[i]->id, images[i], decoded[i]->key->params, decoded[i]->bytes);
+                usage += decoded[i]->bytes;
+                images[i].release();
+            }
+        }
+        evict();
+        return handles;
+    }
+
+    // Загрузка для кода, который хранит идентификатор OpenGL напрямую: ссылка удерживается
+    // кэшем до release(), поэтому текстура не вытесняется
+    unsigned int load(const std::string& path, const TextureParams& params = TextureParams())
+    {
+        pinned.push_back(acquire(path, params));
+        return pinned.back().id();
+    }
+
+    // Пакетный вариант load: идентификаторы в порядке запросов
+    std::vector<unsigned int> load(const std::vector<TextureRequest>& requests)
+    {
+        std::vector<unsigned int> ids;
+        for (Handle& handle : acquire(requests))
+        {
+            ids.push_back(handle.id());
+            pinned.push_back(std::move(handle));
+        }
+        return ids;
+    }
+
+    // Бюджет видеопамяти в байтах; текстуры без ссылок сверх бюджета удаляются сразу
+    void setBudget(size_t bytes)
+    {
+        budget = bytes;
+        evict();
+    }
+
+    // Без sRGB-фреймбуфера (Window::srgb) результат освещения не переводится обратно в sRGB, поэтому
+    // цветовые карты тоже загружаются без преобразования, иначе изображение темнеет
+    void setSrgbEnabled(bool enabled) { srgbEnabled = enabled; }
+
+    size_t memoryUsage() const { return usage; }
+    size_t textureCount() const { return entries.size(); }
+
+    // Удаление всех текстур (до уничтожения контекста OpenGL). Оставшиеся Handle после этого недействительны
+    void release()
+    {
+        pinned.clear();
+        textureStreamer().release();
+        for (auto& item : entries)
+        {
+            gpuResources().remove(GpuResources::Texture, item.second.id);
+            glDeleteTextures(1, &item.second.id);
+        }
+        entries.clear();
+        unused.clear();
+        usage = 0;
+    }
+
+    static const size_t DEFAULT_BUDGET = (size_t)512 << 20;
+
+private:
+    struct Key {
+        std::string path;
+        TextureParams params;
+
+        bool operator==(const Key& other) const { return path == other.path && params == other.params; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const
+        {
+            size_t hash = std::hash<std::string>()(key.path);
+            hash ^= ((size_t)key.params.srgb | (size_t)key.params.flip << 1 | (size_t)key.params.stream << 2 | (size_t)key.params.wrap << 3) * 0x9E3779B97F4A7C15ull;
+            return hash;
+        }
+    };
+    struct Entry {
+        unsigned int id = 0;
+        size_t bytes = 0;
+        unsigned int refs = 0;
+        const Key* key = nullptr;        // ключ в таблице (для удаления из неё)
+        std::list<Entry*>::iterator lru; // место в списке unused, если ссылок нет
+    };
+
+    // Узлы unordered_map не перемещаются при рехэшировании, поэтому Handle хранит указатель на Entry
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    std::list<Entry*> unused; // текстуры без ссылок: в начале - освобожденные последними
+    std::vector<Handle> pinned;
+    size_t budget;
+    size_t usage = 0;
+    bool srgbEnabled = true;
+
+    void addRef(Entry* entry)
+    {
+        if (entry->refs++ == 0 && entry->lru != unused.end())
+        {
+            unused.erase(entry->lru);
+            entry->lru = unused.end();
+        }
+    }
+
+    void releaseRef(Entry* entry)
+    {
+        if (--entry->refs == 0)
+        {
+            unused.push_front(entry);
+            entry->lru = unused.begin();
+            evict();
+        }
+    }
+
+    // Удаление давно не использованных текстур без ссылок, пока объем превышает бюджет
+    void evict()
+    {
+        while (usage > budget && !unused.empty())
+        {
+            Entry* entry = unused.back();
+            unused.pop_back();
+            textureStreamer().remove(entry->id);
+            gpuResources().remove(GpuResources::Texture, entry->id);
+            glDeleteTextures(1, &entry->id);
+            usage -= entry->bytes;
+            Key key = *entry->key; // копия: ключ удаляется вместе с элементом
+            entries.erase(key);
+        }
+    }
+
+    // Путь без "./", "a/../" и повторных разделителей, с прямыми слэшами: разные записи одного файла
+    // дают один ключ
+    static std::string normalizePath(const std::string& path)
+    {
+        std::string unified = path;
+        for (char& c : unified)
+            if (c == '\\')
+                c = '/';
+        bool absolute = !unified.empty() && unified[0] == '/';
+        std::vector<std::string> parts;
+        size_t start = 0;
+        while (start <= unified.size())
+        {
+            size_t end = unified.find('/', start);
+            if (end == std::string::npos)
+                end = unified.size();
+            std::string part = unified.substr(start, end - start);
+            if (part == "..")
+            {
+                if (!parts.empty() && parts.back() != "..")
+                    parts.pop_back();
+                else if (!absolute)
+                    parts.push_back(part);
+            }
+            else if (!part.empty() && part != ".")
+                parts.push_back(part);
+            start = end + 1;
+        }
+        std::string result = absolute ? "/" : "";
+        for (size_t i = 0; i < parts.size(); i++)
+            result += (i ? "/" : "") + parts[i];
+        return result;
+    }
+
+    // Формат OpenGL для запеченной текстуры или 0, если формат не поддерживается
+    static GLenum compressedFormat(uint32_t vkFormat, bool srgb)
+    {
+        static const bool s3tc = hasGlExtension("GL_EXT_texture_compression_s3tc");
+        static const bool s3tcSrgb = s3tc && hasGlExtension("GL_EXT_texture_sRGB");
+        switch (vkFormat)
+        {
+        case Ktx2::BC1_RGB_UNORM: case Ktx2::BC1_RGB_SRGB:
+            if (!s3tc || (srgb && !s3tcSrgb))
+                return 0;
+            return srgb ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case Ktx2::BC3_UNORM: case Ktx2::BC3_SRGB:
+            if (!s3tc || (srgb && !s3tcSrgb))
+                return 0;
+            return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case Ktx2::BC4_UNORM:
+            return GL_COMPRESSED_RED_RGTC1; // RGTC входит в ядро с OpenGL 3.0
+        case Ktx2::BC5_UNORM:
+            return GL_COMPRESSED_RG_RGTC2;
+        default:
+            return 0;
+        }
+    }
+
+    // Запеченная текстура <path>.ktx2 (см. tools/texture_bake.cpp). Используется, только если она
+    // построена из текущей версии исходного файла (или исходного файла нет) с той же ориентацией
+    // и формат поддерживается драйвером; иначе false и текстура загружается из исходного файла
+    static bool uploadCompressed(unsigned int textureID, const std::string& path, const TextureParams& params, size_t& bytes)
+    {
+        MappedFile file(path + ".ktx2");
+        Ktx2::Image image;
+        if (!Ktx2::read(file, image))
+            return false;
+        auto orientation = image.keyValues.find("KTXorientation");
+        if (orientation == image.keyValues.end() || orientation->second != (params.flip ? "ru" : "rd"))
+            return false;
+        uint64_t sourceHash = hashFile(path);
+        if (sourceHash != 0)
+        {
+            char expected[17];
+            std::snprintf(expected, sizeof(expected), "%016llx", (unsigned long long)sourceHash);
+            auto stored = image.keyValues.find("L1SourceHash");
+            if (stored == image.keyValues.end() || stored->second != expected)
+                return false;
+        }
+        GLenum internalFormat = compressedFormat(image.vkFormat, params.srgb);
+        if (internalFormat == 0)
+            return false;
+
+        if (params.stream)
+            bytes = textureStreamer().add(textureID, std::move(file), image, internalFormat);
+        else
+        {
+            glBindTexture(GL_TEXTURE_2D, textureID);
+            for (size_t level = 0; level < image.levels.size(); level++)
+            {
+                GLsizei width = std::max<GLsizei>(1, (GLsizei)(image.width >> level));
+                GLsizei height = std::max<GLsizei>(1, (GLsizei)(image.height >> level));
+                glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)level, internalFormat, width, height, 0,
+                                       (GLsizei)image.levels[level].size, image.levels[level].data);
+                bytes += image.levels[level].size;
+            }
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)image.levels.size() - 1);
+            gpuResources().setTexture(textureID, (int)image.width, (int)image.height, internalFormat, (int)image.levels.size(), bytes);
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, params.wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, params.wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        return true;
+    }
+
+    // Создание текстуры с мип-уровнями из декодированного изображения; bytes - оценка занятой видеопамяти
+    static void upload(unsigned int textureID, const ImageLoader::Image& image, const TextureParams& params, size_t& bytes)
+    {
+        PROFILE_SCOPE("upload texture");
+        if (!image.pixels)
+        {
+            std::cout << "Texture failed to load at path: " << image.path << std::endl;
+            return;
+        }
+
+        GLenum format = GL_RGBA;
+        GLenum internalFormat = params.srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+        if (image.components == 1)
+        {
+            format = GL_RED;
+            internalFormat = GL_R8;
+        }
+        else if (image.components == 2)
+        {
+            format = GL_RG;
+            internalFormat = GL_RG8;
+        }
+        else if (image.components == 3)
+        {
+            format = GL_RGB;
+            internalFormat = params.srgb ? GL_SRGB8 : GL_RGB8;
+        }
+
+        // Мип-уровни строятся на CPU (mipmap.h), а не glGenerateMipmap: одинаково на всех драйверах,
+        // с учетом гаммы у цветовых карт и с сохранением покрытия у вырезанных текстур
+        Mipmap::Options options;
+        options.srgb = params.srgb && image.components >= 3;
+        Mipmap::Level base = Mipmap::expand(image.pixels, image.width, image.height, image.components);
+        options.preserveCoverage = image.components == 4 && Mipmap::isCutout(base);
+        std::vector<Mipmap::Level> levels = Mipmap::generateChain(std::move(base), options);
+
+        glBindTexture(GL_TEXTURE_2D, textureID);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // строки RGB/RED не обязательно выровнены на 4 байта
+        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, image.width, image.height, 0, format, GL_UNSIGNED_BYTE, image.pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        // Уровни из цепочки - RGBA; лишние каналы отбрасываются при загрузке в R8/RG8/RGB8
+        for (size_t level = 1; level < levels.size(); level++)
+            glTexImage2D(GL_TEXTURE_2D, (GLint)level, internalFormat, levels[level].width, levels[level].height, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, levels[level].pixels.data());
+
+        // Параметры выборки по умолчанию; сэмплер, привязанный к юниту (sampler_cache.h), их заменяет
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, params.wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, params.wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        // Драйверы обычно хранят RGB как RGBA; мип-уровни добавляют треть
+        size_t texelBytes = image.components == 3 ? 4 : (size_t)image.components;
+        bytes = (size_t)image.width * image.height * texelBytes * 4 / 3;
+        gpuResources().setTexture(textureID, image.width, image.height, internalFormat, (int)levels.size(), bytes);
+    }
+};
+
+// Кэш текстур процесса
+inline TextureCache& textureCache()
+{
+    static TextureCache cache;
+    return cache;
+}
+#endif
@@ -0,0 +1,347 @@
+#ifndef TEXTURE_STREAMER_H
+#define TEXTURE_STREAMER_H
+
+#include <glad/glad.h>
+
+#include "ktx2.h"
+#include "gpu_resources.h"
+#include "mapped_file.h"
+#include "thread_pool.h"
+#include "profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <unordered_map>
+#include <vector>
+
+// Потоковая загрузка мип-уровней запеченных текстур (KTX2, см. tools/texture_bake.cpp).
+// При загрузке в видеопамять попадает только хвост цепочки - уровни не крупнее TAIL_SIZE, а крупные уровни
+// подгружаются, когда текстура нужна на экране. Доступный диапазон задается GL_TEXTURE_BASE_LEVEL:
+// уровни мельче базового определены, крупнее - нет или освобождены.
+//
+// Код отрисовки сообщает размер объекта на экране (request), и по нему выбирается нужный уровень:
+// текстура считается натянутой на объект один раз, поэтому уровень = log2(размер текстуры / размер на экране).
+// update() раз в кадр распределяет бюджет видеопамяти между текстурами в порядке убывания размера на экране,
+// освобождает лишние уровни и запускает загрузку недостающих. Загрузка асинхронная: данные уровня копируются
+// из отображенного файла в отображенный буфер распаковки (PBO) в пуле потоков (чтение с диска не задерживает
+// кадр), а в одном из следующих кадров уровень создается из PBO, и драйвер передает его без ожидания CPU
+class TextureStreamer
+{
+public:
+    // Уровни с большей стороной не больше TAIL_SIZE загружаются сразу и не выгружаются
+    static const int TAIL_SIZE = 128;
+    // Одновременно загружаемые уровни и их объем, запускаемый за кадр
+    static const size_t MAX_JOBS = 4;
+    static const size_t MAX_FRAME_BYTES = (size_t)8 << 20;
+    // Текстура, которую не запрашивали столько кадров, сжимается до хвоста
+    static const uint64_t KEEP_FRAMES = 120;
+    static const size_t DEFAULT_BUDGET = (size_t)256 << 20;
+
+    explicit TextureStreamer(size_t budgetBytes = DEFAULT_BUDGET) : budget(budgetBytes) {}
+
+    // Регистрация текстуры textureID из отображенного файла KTX2: загружается хвост цепочки, остальные
+    // уровни подгружаются по запросу. Возвращает объем загруженного хвоста в байтах
+    size_t add(unsigned int textureID, MappedFile&& file, const Ktx2::Image& image, GLenum internalFormat)
+    {
+        Record record;
+        record.image = image;
+        record.internalFormat = internalFormat;
+        int levelCount = (int)image.levels.size();
+        record.tailLevel = 0;
+        while (record.tailLevel + 1 < levelCount && std::max(levelWidth(record, record.tailLevel), levelHeight(record, record.tailLevel)) > TAIL_SIZE)
+            record.tailLevel++;
+        record.residentLevel = record.desiredLevel = record.tailLevel;
+
+        glBindTexture(GL_TEXTURE_2D, textureID);
+        size_t tailBytes = 0;
+        for (int level = record.tailLevel; level < levelCount; level++)
+        {
+            glCompressedTexImage2D(GL_TEXTURE_2D, level, internalFormat, levelWidth(record, level), levelHeight(record, level), 0,
+                                   (GLsizei)image.levels[level].size, image.levels[level].data);
+            tailBytes += image.levels[level].size;
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, record.tailLevel);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+        record.tailBytes = tailBytes;
+        gpuResources().setTexture(textureID, (int)image.width, (int)image.height, internalFormat, levelCount - record.tailLevel, tailBytes);
+
+        // Текстуры, целиком помещающиеся в хвост, не отслеживаются
+        if (record.tailLevel > 0)
+        {
+            record.file = std::move(file);
+            records.emplace(textureID, std::move(record));
+        }
+        return tailBytes;
+    }
+
+    // Текстура нужна в этом кадре на объекте размером screenSize пикселей (максимум по всем запросам кадра).
+    // Вызывается при отрисовке, поэтому не выделяет память; незарегистрированные текстуры пропускаются
+    void request(unsigned int textureID, float screenSize)
+    {
+        auto found = records.find(textureID);
+        if (found == records.end())
+            return;
+        Record& record = found->second;
+        if (record.requestFrame != frame)
+        {
+            record.requestFrame = frame;
+            record.screenSize = 0.0f;
+        }
+        record.screenSize = std::max(record.screenSize, screenSize);
+    }
+
+    // Раз в кадр в потоке с контекстом OpenGL: завершение загрузок, распределение бюджета, выгрузка
+    // и запуск загрузки уровней
+    void update()
+    {
+        PROFILE_SCOPE("stream textures");
+        finishJobs();
+        assignLevels();
+
+        size_t frameBytes = 0;
+        for (auto& item : records)
+        {
+            Record& record = item.second;
+            if (record.desiredLevel > record.residentLevel)
+                dropLevels(item.first, record, record.desiredLevel);
+            else if (record.desiredLevel < record.residentLevel && !record.loading && jobs.size() < MAX_JOBS && frameBytes < MAX_FRAME_BYTES)
+            {
+                frameBytes += record.image.levels[record.residentLevel - 1].size;
+                startJob(item.first, record, record.residentLevel - 1);
+            }
+        }
+        frame++;
+    }
+
+    // Удаление текстуры из потоковой загрузки (перед glDeleteTextures)
+    void remove(unsigned int textureID)
+    {
+        auto found = records.find(textureID);
+        if (found == records.end())
+            return;
+        for (size_t i = 0; i < jobs.size(); i++)
+            if (jobs[i].texture == textureID)
+            {
+                cancelJob(i);
+                break;
+            }
+        resident -= found->second.streamedBytes;
+        records.erase(found);
+    }
+
+    // Бюджет видеопамяти на уровни сверх хвоста
+    void setBudget(size_t bytes) { budget = bytes; }
+
+    size_t memoryUsage() const { return resident; }
+    size_t textureCount() const { return records.size(); }
+    size_t pendingCount() const { return jobs.size(); }
+
+    // Ожидание загрузок и удаление буферов (до уничтожения контекста OpenGL)
+    void release()
+    {
+        while (!jobs.empty())
+            cancelJob(jobs.size() - 1);
+        for (unsigned int buffer : freeBuffers)
+            gpuResources().remove(GpuResources::Buffer, buffer);
+        glDeleteBuffers((GLsizei)freeBuffers.size(), freeBuffers.data());
+        freeBuffers.clear();
+        records.clear();
+        resident = 0;
+    }
+
+private:
+    struct Record {
+        MappedFile file;          // данные уровней (image.levels указывают в отображение)
+        Ktx2::Image image;
+        GLenum internalFormat = 0;
+        int tailLevel = 0;        // первый уровень хвоста
+        int residentLevel = 0;    // базовый уровень (загружены уровни от него и мельче)
+        int desiredLevel = 0;
+        float screenSize = 0.0f;
+        uint64_t requestFrame = 0;
+        size_t tailBytes = 0;
+        size_t streamedBytes = 0; // объем загруженных уровней сверх хвоста
+        bool loading = false;
+    };
+    // Загрузка одного уровня: копирование в отображенный PBO в пуле потоков
+    struct Job {
+        unsigned int texture;
+        int level;
+        unsigned int buffer;
+        std::future<void> copied;
+    };
+
+    std::unordered_map<unsigned int, Record> records;
+    std::vector<Job> jobs;
+    std::vector<unsigned int> freeBuffers;
+    std::vector<Record*> order; // порядок распределения бюджета (переиспользуется между кадрами)
+    size_t budget;
+    size_t resident = 0;
+    uint64_t frame = 1;
+
+    static GLsizei levelWidth(const Record& record, int level) { return std::max<GLsizei>(1, (GLsizei)(record.image.width >> level)); }
+    static GLsizei levelHeight(const Record& record, int level) { return std::max<GLsizei>(1, (GLsizei)(record.image.height >> level)); }
+
+    // Объем уровней [level, tailLevel)
+    static size_t streamedBytes(const Record& record, int level)
+    {
+        size_t bytes = 0;
+        for (int l = level; l < record.tailLevel; l++)
+            bytes += record.image.levels[l].size;
+        return bytes;
+    }
+
+    // Самый крупный нужный уровень для объекта размером screenSize пикселей
+    static int neededLevel(const Record& record, float screenSize)
+    {
+        if (screenSize <= 0.0f)
+            return record.tailLevel;
+        float size = (float)std::max(record.image.width, record.image.height);
+        int level = (int)std::floor(std::log2(std::max(size / screenSize, 1.0f)));
+        return std::min(level, record.tailLevel);
+    }
+
+    // Бюджет распределяется начиная с самых крупных на экране текстур; текстуре, которой не хватает
+    // бюджета на нужный уровень, достается самый крупный помещающийся
+    void assignLevels()
+    {
+        order.clear();
+        for (auto& item : records)
+        {
+            Record& record = item.second;
+            if (frame - record.requestFrame > KEEP_FRAMES)
+                record.screenSize = 0.0f;
+            order.push_back(&record);
+        }
+        std::sort(order.begin(), order.end(), [](const Record* a, const Record* b) { return a->screenSize > b->screenSize; });
+        size_t remaining = budget;
+        for (Record* record : order)
+        {
+            int level = neededLevel(*record, record->screenSize);
+            size_t bytes = streamedBytes(*record, level);
+            while (level < record->tailLevel && bytes > remaining)
+                bytes -= record->image.levels[level++].size;
+            remaining -= bytes;
+            record->desiredLevel = level;
+        }
+    }
+
+    // Освобождение уровней крупнее level: сначала поднимается базовый уровень, затем уровни
+    // переопределяются пустыми
+    void dropLevels(unsigned int textureID, Record& record, int level)
+    {
+        glBindTexture(GL_TEXTURE_2D, textureID);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level);
+        for (int l = record.residentLevel; l < level; l++)
+        {
+            glTexImage2D(GL_TEXTURE_2D, l, GL_RGBA8, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+            record.streamedBytes -= record.image.levels[l].size;
+            resident -= record.image.levels[l].size;
+        }
+        record.residentLevel = level;
+        reportResidency(textureID, record);
+    }
+
+    void startJob(unsigned int textureID, Record& record, int level)
+    {
+        const Ktx2::Image::Level& data = record.image.levels[level];
+        unsigned int buffer;
+        if (freeBuffers.empty())
+        {
+            glGenBuffers(1, &buffer);
+            gpuResources().addBuffer(buffer, GL_PIXEL_UNPACK_BUFFER, data.size, "texture streamer");
+        }
+        else
+        {
+            buffer = freeBuffers.back();
+            freeBuffers.pop_back();
+            gpuResources().resize(GpuResources::Buffer, buffer, data.size);
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)data.size, NULL, GL_STREAM_DRAW);
+        void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)data.size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        if (!mapped)
+        {
+            freeBuffers.push_back(buffer);
+            return;
+        }
+        record.loading = true;
+        const unsigned char* source = data.data;
+        size_t size = data.size;
+        jobs.push_back({ textureID, level, buffer, workerPool().submit([mapped, source, size]() {
+            PROFILE_SCOPE("stream texture level");
+            std::memcpy(mapped, source, size);
+        }) });
+    }
+
+    // Уровни, скопированные в PBO, создаются из него; уровень, ставший ненужным за время загрузки, отбрасывается
+    void finishJobs()
+    {
+        for (size_t i = 0; i < jobs.size();)
+        {
+            Job& job = jobs[i];
+            if (job.copied.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                i++;
+                continue;
+            }
+            job.copied.get();
+            Record& record = records.at(job.texture);
+            record.loading = false;
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, job.buffer);
+            bool valid = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+            if (valid && record.residentLevel == job.level + 1 && record.desiredLevel <= job.level)
+            {
+                const Ktx2::Image::Level& data = record.image.levels[job.level];
+                glBindTexture(GL_TEXTURE_2D, job.texture);
+                glCompressedTexImage2D(GL_TEXTURE_2D, job.level, record.internalFormat, levelWidth(record, job.level),
+                                       levelHeight(record, job.level), 0, (GLsizei)data.size, (void*)0);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, job.level);
+                record.residentLevel = job.level;
+                record.streamedBytes += data.size;
+                resident += data.size;
+                reportResidency(job.texture, record);
+            }
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            freeBuffers.push_back(job.buffer);
+            jobs[i] = std::move(jobs.back());
+            jobs.pop_back();
+        }
+    }
+
+    // Загруженные уровни текстуры в учете видеопамяти (gpu_resources.h)
+    static void reportResidency(unsigned int textureID, const Record& record)
+    {
+        gpuResources().resize(GpuResources::Texture, textureID, record.tailBytes + record.streamedBytes,
+                              (int)record.image.levels.size() - record.residentLevel);
+    }
+
+    // Ожидание копирования и возврат буфера без создания уровня
+    void cancelJob(size_t index)
+    {
+        Job& job = jobs[index];
+        job.copied.wait();
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, job.buffer);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        freeBuffers.push_back(job.buffer);
+        auto found = records.find(job.texture);
+        if (found != records.end())
+            found->second.loading = false;
+        jobs[index] = std::move(jobs.back());
+        jobs.pop_back();
+    }
+};
+
+// Потоковая загрузка текстур процесса
+inline TextureStreamer& textureStreamer()
+{
+    static TextureStreamer streamer;
+    return streamer;
+}
+#endif
@@ -0,0 +1,160 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Пул рабочих потоков для фоновой работы без OpenGL (загрузка ресурсов, преобразование мешей и т.п.).
+// Вызовы OpenGL из задач запрещены: контекст привязан только к главному потоку
+class ThreadPool
+{
+public:
+    // По умолчанию - по потоку на ядро, кроме одного, занятого главным потоком
+    explicit ThreadPool(unsigned int threadCount = defaultThreadCount())
+    {
+        for (unsigned int i = 0; i < threadCount; i++)
+            workers.emplace_back([this, i]() { workerLoop(i); });
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static unsigned int defaultThreadCount()
+    {
+        unsigned int cores = std::thread::hardware_concurrency();
+        return cores > 1 ? cores - 1 : 1;
+    }
+
+    size_t size() const { return workers.size(); }
+
+    // Поставить задачу в очередь; результат (или исключение) возвращается через future
+    template <typename F, typename Result = decltype(std::declval<F&>()())>
+    std::future<Result> submit(F&& task)
+    {
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> result = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.emplace_back([packaged]() { (*packaged)(); });
+        }
+        wake.notify_one();
+        return result;
+    }
+
+    // body(i) для всех i из [0, count). Вызывающий поток тоже берет элементы, поэтому parallelFor
+    // можно вызывать и из задачи пула: ожидание идет по числу обработанных элементов, а не задач.
+    // Первое исключение из body пробрасывается вызывающему после обработки всех элементов
+    template <typename F>
+    void parallelFor(size_t count, F&& body)
+    {
+        if (count == 0)
+            return;
+        struct State {
+            std::atomic<size_t> next{ 0 };
+            std::atomic<size_t> done{ 0 };
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::exception_ptr error;
+        };
+        std::shared_ptr<State> state = std::make_shared<State>();
+        auto* bodyPtr = &body;
+        // Задачи, начавшие работу после обработки всех элементов, не обращаются к body
+        auto run = [state, count, bodyPtr]() {
+            for (size_t i; (i = state->next.fetch_add(1)) < count; )
+            {
+                try
+                {
+                    (*bodyPtr)(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    if (!state->error)
+                        state->error = std::current_exception();
+                }
+                if (state->done.fetch_add(1) + 1 == count)
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->finished.notify_all();
+                }
+            }
+        };
+
+        size_t helpers = std::min(workers.size(), count - 1);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < helpers; i++)
+                tasks.emplace_back(run);
+        }
+        wake.notify_all();
+        run();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [&]() { return state->done.load() == count; });
+        if (state->error)
+            std::rethrow_exception(state->error);
+    }
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    void workerLoop(unsigned int index)
+    {
+#ifdef LESSON1_PROFILING
+        std::string name = "worker " + std::to_string(index);
+        PROFILE_THREAD_NAME(name.c_str());
+#else
+        (void)index;
+#endif
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty())
+                    return;
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+// Общий пул приложения, создается при первом обращении
+inline ThreadPool& workerPool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+#endif
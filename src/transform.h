@@ -0,0 +1,33 @@
+#ifndef TRANSFORM_H
+#define TRANSFORM_H
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+
+// Матрица нормалей - транспонированная обратная матрица к верхней 3x3 части матрицы модели.
+// Вычисляется на CPU один раз на объект, а не в вершинном шейдере для каждой вершины
+inline glm::mat3 NormalMatrix(const glm::mat4& model)
+{
+    glm::mat3 m(model);
+
+    // Быстрый путь №1: чистый перенос (все кубы террейна) - нормали не меняются
+    if (m == glm::mat3(1.0f))
+        return glm::mat3(1.0f);
+
+    // Быстрый путь №2: поворот с равномерным масштабом s. Тогда (M^-1)^T = M / s^2
+    float sx = glm::dot(m[0], m[0]);
+    float sy = glm::dot(m[1], m[1]);
+    float sz = glm::dot(m[2], m[2]);
+    const float eps = 1e-5f;
+    if (std::abs(sx - sy) < eps * sx && std::abs(sx - sz) < eps * sx &&
+        std::abs(glm::dot(m[0], m[1])) < eps * sx &&
+        std::abs(glm::dot(m[0], m[2])) < eps * sx &&
+        std::abs(glm::dot(m[1], m[2])) < eps * sx)
+        return m / sx;
+
+    // Общий случай: неравномерный масштаб или сдвиг
+    return glm::transpose(glm::inverse(m));
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef VERTEX_H
+#define VERTEX_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+struct Vertex {
+
+    // Позиция
+    glm::vec3 Position;
+
+    // Нормаль
+    glm::vec3 Normal;
+
+    // Текстурные координаты
+    glm::vec2 TexCoords;
+
+    // Касательный вектор
+    glm::vec3 Tangent;
+
+    // Вектор бинормали (вектор, перпендикулярный касательному вектору и вектору нормали)
+    glm::vec3 Bitangent;
+};
+
+// Скелетная анимация: до четырех костей вершины (индексы в Skeleton::bones) и их веса в долях 255.
+// Хранятся отдельным потоком (свой буфер в GeometryPool), который создается только для мешей с костями,
+// так что статические вершины не становятся больше. У вершин без костей все веса нулевые
+struct VertexBones {
+    unsigned char Ids[4];
+    unsigned char Weights[4];
+};
+
+// Указатели вершинных атрибутов для массива Vertex. VAO и вершинный буфер уже должны быть привязаны
+inline void setVertexAttributes()
+{
+    // Координаты вершин
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+
+    // Нормали вершин
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
+
+    // Текстурные координаты вершин
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
+
+    // Касательный вектор вершины
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Tangent));
+
+    // Вектор бинормали вершины
+    glEnableVertexAttribArray(4);
+    glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Bitangent));
+}
+
+// Указатели атрибутов костей для массива VertexBones (5-8 заняты матрицей экземпляра, см. instancing.h).
+// VAO и буфер костей уже должны быть привязаны
+inline void setBoneAttributes()
+{
+    glEnableVertexAttribArray(9);
+    glVertexAttribIPointer(9, 4, GL_UNSIGNED_BYTE, sizeof(VertexBones), (void*)offsetof(VertexBones, Ids));
+    glEnableVertexAttribArray(10);
+    glVertexAttribPointer(10, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(VertexBones), (void*)offsetof(VertexBones, Weights));
+}
+
+// Формат вершин в буферах OpenGL: полный (Vertex, 56 байт) или сжатый (PackedVertex, 20 байт)
+enum class VertexFormat { Full, Packed };
+
+// Сжатая вершина для отрисовки:
+//   позиция - 16-битные беззнаковые нормированные числа внутри ограничивающего параллелепипеда (VertexQuantization);
+//             в четвертой компоненте - знак бинормали (0 - минус, 65535 - плюс)
+//   нормаль и касательный вектор - октаэдрическое кодирование в два 16-битных знаковых нормированных числа
+//   текстурные координаты - half float (UV могут выходить за [0, 1] при повторении текстуры)
+// Бинормаль не хранится: шейдер восстанавливает её как cross(нормаль, касательная) * знак.
+// Костей у сжатого формата нет: анимированные модели используют полный формат (Model::DrawAnimated отклоняет
+// модели со сжатыми вершинами). Декодирование - см. shaders/model_packed.vs
+struct PackedVertex {
+    uint16_t Position[4];
+    int16_t Normal[2];
+    int16_t Tangent[2];
+    uint16_t TexCoords[2];
+};
+
+// Преобразование квантованной позиции в координаты модели: position = offset + q * scale, q в [0, 1]
+struct VertexQuantization {
+    glm::vec3 offset = glm::vec3(0.0f);
+    glm::vec3 scale = glm::vec3(1.0f);
+
+    static VertexQuantization fromBounds(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+    {
+        VertexQuantization q;
+        q.offset = boundsMin;
+        // Нулевая протяженность по оси (плоский меш) заменяется единицей, чтобы не делить на ноль
+        q.scale = glm::max(boundsMax - boundsMin, glm::vec3(1e-6f));
+        return q;
+    }
+};
+
+// Октаэдрическое кодирование единичного вектора: проекция на октаэдр |x| + |y| + |z| = 1
+// и развертка нижней половины на квадрат [-1, 1]^2
+inline glm::vec2 octEncode(glm::vec3 n)
+{
+    n /= glm::max(glm::abs(n.x) + glm::abs(n.y) + glm::abs(n.z), 1e-20f);
+    glm::vec2 e(n.x, n.y);
+    if (n.z < 0.0f)
+        e = (1.0f - glm::abs(glm::vec2(e.y, e.x))) * glm::vec2(e.x >= 0.0f ? 1.0f : -1.0f, e.y >= 0.0f ? 1.0f : -1.0f);
+    return e;
+}
+
+inline glm::vec3 octDecode(glm::vec2 e)
+{
+    glm::vec3 n(e.x, e.y, 1.0f - glm::abs(e.x) - glm::abs(e.y));
+    float t = glm::max(-n.z, 0.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return glm::normalize(n);
+}
+
+inline PackedVertex packVertex(const Vertex& vertex, const VertexQuantization& quantization)
+{
+    PackedVertex packed;
+    glm::vec3 q = (vertex.Position - quantization.offset) / quantization.scale;
+    for (int i = 0; i < 3; i++)
+        packed.Position[i] = glm::packUnorm1x16(q[i]);
+    bool rightHanded = glm::dot(glm::cross(vertex.Normal, vertex.Tangent), vertex.Bitangent) >= 0.0f;
+    packed.Position[3] = rightHanded ? 65535 : 0;
+    glm::vec2 normal = octEncode(vertex.Normal), tangent = octEncode(vertex.Tangent);
+    for (int i = 0; i < 2; i++)
+    {
+        packed.Normal[i] = (int16_t)glm::packSnorm1x16(normal[i]);
+        packed.Tangent[i] = (int16_t)glm::packSnorm1x16(tangent[i]);
+        packed.TexCoords[i] = glm::packHalf1x16(vertex.TexCoords[i]);
+    }
+    return packed;
+}
+
+// Указатели вершинных атрибутов для массива PackedVertex: номера атрибутов те же, что у Vertex, атрибут 4 не используется
+inline void setPackedVertexAttributes()
+{
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, Position));
+
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, Normal));
+
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, TexCoords));
+
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 2, GL_SHORT, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, Tangent));
+
+    glDisableVertexAttribArray(4);
+    glDisableVertexAttribArray(9);
+    glDisableVertexAttribArray(10);
+}
+
+// Размер вершины в буфере для формата
+inline size_t vertexStride(VertexFormat format)
+{
+    return format == VertexFormat::Packed ? sizeof(PackedVertex) : sizeof(Vertex);
+}
+#endif
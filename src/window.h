@@ -8,7 +8,10 @@ public:
 	static int width;
 	static int height;
 	static GLFWwindow* window;
-	static int initialize(int width, int height, const char* title);
+	static bool headless;
+	static unsigned int framebuffer;
+	static bool srgb;
+	static int initialize(int width, int height, const char* title, bool headless = false);
 	static void terminate();
 
 	static void setCursorMode(int mode);
@@ -18,23 +21,50 @@ public:
 };
 
 #include <iostream>
-//#include <GLFW/glfw3.h>
-#include "Window.h"
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "window.h"
+#include "gpu_resources.h"
 
 GLFWwindow* Window::window;
 int Window::width = 0;
 int Window::height = 0;
+bool Window::headless = false;
+unsigned int Window::framebuffer = 0;
+bool Window::srgb = false;
+static unsigned int offscreenColor = 0;
+static unsigned int offscreenDepth = 0;
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void mouse_callback(GLFWwindow* window, double xpos, double ypos);
 void scroll_callback(GLFWwindow* window, double xoffset, double yoffset);
 
-int Window::initialize(int width, int height, const char* title) 
+// headless: окно не показывается, контекст создается через OSMesa (программный llvmpipe),
+// а кадр рисуется во внеэкранный фреймбуфер. Для машин без дисплея GLFW собирается
+// с GLFW_USE_OSMESA=ON (платформа null), см. CMakeLists.txt.
+// Цель рендеринга запрашивается в sRGB: шейдеры считают освещение в линейном пространстве, а перевод
+// в sRGB при записи (GL_FRAMEBUFFER_SRGB) и обратно при чтении sRGB-текстур выполняет оборудование.
+// Window::srgb - удалось ли получить sRGB-фреймбуфер
+int Window::initialize(int width, int height, const char* title, bool headless) 
 {
-	glfwInit();
+	Window::width = width;
+	Window::height = height;
+	Window::headless = headless;
+
+	if (!glfwInit())
+	{
+		std::cout << "Failed to initialize GLFW" << std::endl;
+		return -1;
+	}
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_SRGB_CAPABLE, GLFW_TRUE);
+	if (headless)
+	{
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+	}
 
 	window = glfwCreateWindow(width, height, title, NULL, NULL);
 	if (window == NULL)
@@ -46,6 +76,50 @@ int Window::initialize(int width, int height, const char* title)
 
 	glfwMakeContextCurrent(window);
 
+	// glad: загрузка всех указателей на OpenGL-функции
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	{
+		std::cout << "Failed to initialize GLAD" << std::endl;
+		glfwTerminate();
+		return -1;
+	}
+
+	if (headless)
+	{
+		// Внеэкранный фреймбуфер: цвет sRGB8_ALPHA8 и глубина 24 бита
+		glGenFramebuffers(1, &framebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+		glGenRenderbuffers(1, &offscreenColor);
+		glBindRenderbuffer(GL_RENDERBUFFER, offscreenColor);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_SRGB8_ALPHA8, width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, offscreenColor);
+
+		glGenRenderbuffers(1, &offscreenDepth);
+		glBindRenderbuffer(GL_RENDERBUFFER, offscreenDepth);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, offscreenDepth);
+
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		{
+			std::cout << "Offscreen framebuffer is not complete" << std::endl;
+			glfwTerminate();
+			return -1;
+		}
+		glViewport(0, 0, width, height);
+		srgb = true;
+		glEnable(GL_FRAMEBUFFER_SRGB);
+		return 0;
+	}
+
+	GLint encoding = GL_LINEAR;
+	glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_BACK_LEFT, GL_FRAMEBUFFER_ATTACHMENT_COLOR_ENCODING, &encoding);
+	srgb = encoding == GL_SRGB;
+	if (srgb)
+		glEnable(GL_FRAMEBUFFER_SRGB);
+	else
+		std::cout << "sRGB framebuffer is not available, colour textures are sampled without conversion" << std::endl;
+
 	glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 	glfwSetCursorPosCallback(window, mouse_callback);
 	glfwSetScrollCallback(window, scroll_callback);
@@ -58,6 +132,15 @@ void Window::setCursorMode(int mode) {
 }
 
 void Window::terminate() {
+	// Все текстуры и буферы к этому моменту должны быть удалены их владельцами
+	gpuResources().reportLeaks();
+	if (framebuffer)
+	{
+		glDeleteFramebuffers(1, &framebuffer);
+		glDeleteRenderbuffers(1, &offscreenColor);
+		glDeleteRenderbuffers(1, &offscreenDepth);
+		framebuffer = 0;
+	}
 	glfwTerminate();
 }
 
@@ -70,7 +153,11 @@ void Window::setShouldClose(bool flag) {
 }
 
 void Window::swapBuffers() {
-	glfwSwapBuffers(window);
+	// Без окна показывать нечего: достаточно отправить команды на выполнение
+	if (headless)
+		glFlush();
+	else
+		glfwSwapBuffers(window);
 }
 
 #endif /* WINDOW_WINDOW_H_ */
\ No newline at end of file
@@ -0,0 +1,128 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "shader.h"
+#include "render_stats.h"
+#include "heightmap.h"
+#include "thread_pool.h"
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Карта высот мира из кубов: в столбце (x, z) лежит height(x, z) кубов
+class World
+{
+public:
+    int width = 0;
+    int depth = 0;
+    std::vector<int> heights;
+
+    World() {}
+    World(int width, int depth) : width(width), depth(depth), heights((size_t)width * depth, 0) {}
+
+    int height(int x, int z) const
+    {
+        return heights[(size_t)z * width + x];
+    }
+
+    void setHeight(int x, int z, int h)
+    {
+        heights[(size_t)z * width + x] = h;
+    }
+
+    // Один куб на 15 единиц 8-битной карты высот (как и раньше в main.cpp), в 16-битных единицах Heightmap.
+    // Высота столбца - целое число кубов, поэтому дробная часть отбрасывается: 8- и 16-битная карта дают одни и те же
+    // 18 уровней (0-17), и лишняя точность 16-битного файла миру из кубов не нужна
+    static const int HEIGHT_STEP = 15 * 257;
+
+    // Мир из левого верхнего угла карты высот: фрагменты карты копируются в мир параллельно
+    static World fromHeightmap(const Heightmap& heightmap, int width, int depth)
+    {
+        World world(width, depth);
+        workerPool().parallelFor(heightmap.chunks.size(), [&](size_t i) {
+            const Heightmap::Chunk& chunk = heightmap.chunks[i];
+            for (int z = chunk.z; z < chunk.z + chunk.depth && z < depth; z++)
+                for (int x = chunk.x; x < chunk.x + chunk.width && x < width; x++)
+                    world.setHeight(x, z, chunk.sample(x - chunk.x, z - chunk.z) / HEIGHT_STEP);
+        });
+        return world;
+    }
+
+    static World fromHeightmap(const char* path, int width, int depth)
+    {
+        Heightmap heightmap;
+        heightmap.load(path);
+        return fromHeightmap(heightmap, width, depth);
+    }
+
+    // Процедурно расширенный мир: исходная карта повторяется с отражением, поверх добавляется
+    // детерминированный шум, чтобы соседние плитки не совпадали
+    static World extended(const World& source, int width, int depth, unsigned int seed = 1)
+    {
+        World world(width, depth);
+        for (int z = 0; z < depth; z++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                int sx = x % (2 * source.width);
+                int sz = z % (2 * source.depth);
+                if (sx >= source.width) sx = 2 * source.width - 1 - sx;
+                if (sz >= source.depth) sz = 2 * source.depth - 1 - sz;
+
+                float noise = valueNoise(x * 0.05f, z * 0.05f, seed) * 4.0f - 2.0f;
+                int h = source.height(sx, sz) + (int)std::floor(noise);
+                world.setHeight(x, z, h < 0 ? 0 : h);
+            }
+        }
+        return world;
+    }
+
+    // Рисует все кубы в прямоугольнике [x0, x1) x [z0, z1) вокруг (обрезанном по границам мира),
+    // по одному вызову glDrawArrays на куб. Шейдер и VAO куба уже должны быть привязаны
+    void draw(const Shader& shader, int x0, int z0, int x1, int z1) const
+    {
+        if (x0 < 0) x0 = 0;
+        if (z0 < 0) z0 = 0;
+        if (x1 > width) x1 = width;
+        if (z1 > depth) z1 = depth;
+        for (int x = x0; x < x1; x++)
+        {
+            for (int z = z0; z < z1; z++)
+            {
+                for (int y = 0; height(x, z) > y; y++)
+                {
+                    glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3((float)x + 0.5f, (float)y, (float)z + 0.5f));
+                    shader.setMat4("model", model);
+                    glDrawArrays(GL_TRIANGLES, 0, 36);
+                    renderStats().draw(12);
+                }
+            }
+        }
+    }
+
+private:
+    static float hash(int x, int z, unsigned int seed)
+    {
+        unsigned int h = (unsigned int)x * 374761393u + (unsigned int)z * 668265263u + seed * 2246822519u;
+        h = (h ^ (h >> 13)) * 1274126177u;
+        return (h ^ (h >> 16)) / 4294967295.0f;
+    }
+
+    static float valueNoise(float x, float z, unsigned int seed)
+    {
+        int ix = (int)std::floor(x), iz = (int)std::floor(z);
+        float fx = x - ix, fz = z - iz;
+        fx = fx * fx * (3.0f - 2.0f * fx);
+        fz = fz * fz * (3.0f - 2.0f * fz);
+        float a = hash(ix, iz, seed), b = hash(ix + 1, iz, seed);
+        float c = hash(ix, iz + 1, seed), d = hash(ix + 1, iz + 1, seed);
+        return glm::mix(glm::mix(a, b, fx), glm::mix(c, d, fx), fz);
+    }
+};
+#endif
@@ -0,0 +1,146 @@
+// Запекание текстур: PNG/JPG/TGA -> KTX2 с мип-уровнями, сжатыми в BCn.
+// Сжатая текстура занимает в видеопамяти в 4-8 раз меньше и загружается без декодирования изображения:
+// TextureCache находит рядом с исходным файлом <файл>.ktx2 и загружает уровни через glCompressedTexImage2D.
+// Формат выбирается по содержимому: BC1 для непрозрачных цветовых карт, BC3 при наличии альфа-канала,
+// BC4 для одноканальных изображений, BC5 для карт нормалей (--normal, только XY).
+//
+// Мип-уровни строятся фильтром Кайзера (--box - среднее 2x2, по нечетной стороне многофазное среднее 3 отсчетов, как при загрузке), у --srgb - в линейном
+// пространстве; у вырезанных текстур (альфа почти везде 0 или 255) сохраняется покрытие альфа-теста.
+//
+// Запуск:
+//   TextureBake input.png [output.ktx2] [--normal] [--srgb] [--no-flip] [--box]
+// По умолчанию результат пишется в input.png.ktx2, изображение переворачивается по вертикали, как
+// при загрузке в TextureCache (TextureParams::flip). --srgb помечает формат как sRGB (для BC1/BC3)
+#include "../src/stb_image.h"
+#include "../src/block_compression.h"
+#include "../src/ktx2.h"
+#include "../src/mipmap.h"
+#include "../src/mapped_file.h"
+#include "../src/thread_pool.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+    std::string inputPath, outputPath;
+    bool normalMap = false, srgb = false, flip = true, box = false;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--normal")
+            normalMap = true;
+        else if (arg == "--srgb")
+            srgb = true;
+        else if (arg == "--no-flip")
+            flip = false;
+        else if (arg == "--box")
+            box = true;
+        else if (inputPath.empty())
+            inputPath = arg;
+        else
+            outputPath = arg;
+    }
+    if (inputPath.empty())
+    {
+        std::cout << "Usage: TextureBake input.png [output.ktx2] [--normal] [--srgb] [--no-flip] [--box]" << std::endl;
+        return 1;
+    }
+    if (outputPath.empty())
+        outputPath = inputPath + ".ktx2";
+
+    auto start = std::chrono::steady_clock::now();
+    stbi_set_flip_vertically_on_load_thread(flip);
+    int width, height, nrComponents;
+    unsigned char* data = stbi_load(inputPath.c_str(), &width, &height, &nrComponents, 4);
+    if (!data)
+    {
+        std::cout << "ERROR::TEXTURE_BAKE::CANNOT_LOAD " << inputPath << std::endl;
+        return 1;
+    }
+
+    bool hasAlpha = false;
+    if (nrComponents == 2 || nrComponents == 4)
+        for (size_t i = 0; i < (size_t)width * height && !hasAlpha; i++)
+            hasAlpha = data[i * 4 + 3] != 255;
+
+    BlockCompression::Format format = BlockCompression::BC1;
+    uint32_t vkFormat = srgb ? Ktx2::BC1_RGB_SRGB : Ktx2::BC1_RGB_UNORM;
+    if (normalMap)
+    {
+        format = BlockCompression::BC5;
+        vkFormat = Ktx2::BC5_UNORM;
+    }
+    else if (nrComponents == 1)
+    {
+        format = BlockCompression::BC4;
+        vkFormat = Ktx2::BC4_UNORM;
+    }
+    else if (hasAlpha)
+    {
+        format = BlockCompression::BC3;
+        vkFormat = srgb ? Ktx2::BC3_SRGB : Ktx2::BC3_UNORM;
+    }
+
+    Mipmap::Options options;
+    options.filter = box ? Mipmap::Box : Mipmap::Kaiser;
+    options.srgb = srgb && !normalMap && nrComponents >= 3;
+    Mipmap::Level base = Mipmap::expand(data, width, height, 4);
+    stbi_image_free(data);
+    options.preserveCoverage = hasAlpha && Mipmap::isCutout(base);
+    std::vector<Mipmap::Level> levels = Mipmap::generateChain(std::move(base), options);
+
+    // Строки блоков всех уровней сжимаются параллельно
+    struct Job {
+        size_t level;
+        int firstRow, lastRow;
+    };
+    const int ROWS_PER_JOB = 8;
+    std::vector<std::vector<unsigned char>> compressed(levels.size());
+    std::vector<Job> jobs;
+    for (size_t l = 0; l < levels.size(); l++)
+    {
+        compressed[l].resize(BlockCompression::imageBytes(format, levels[l].width, levels[l].height));
+        int blockRows = (levels[l].height + 3) / 4;
+        for (int row = 0; row < blockRows; row += ROWS_PER_JOB)
+            jobs.push_back({ l, row, std::min(row + ROWS_PER_JOB, blockRows) });
+    }
+    workerPool().parallelFor(jobs.size(), [&](size_t i) {
+        const Job& job = jobs[i];
+        const Mipmap::Level& level = levels[job.level];
+        BlockCompression::compressRows(format, level.pixels.data(), level.width, level.height, job.firstRow, job.lastRow,
+                                       compressed[job.level].data());
+    });
+
+    Ktx2::Image image;
+    image.vkFormat = vkFormat;
+    image.width = (uint32_t)width;
+    image.height = (uint32_t)height;
+    size_t compressedBytes = 0;
+    for (const auto& level : compressed)
+    {
+        image.levels.push_back({ level.data(), level.size() });
+        compressedBytes += level.size();
+    }
+    char sourceHash[17];
+    std::snprintf(sourceHash, sizeof(sourceHash), "%016llx", (unsigned long long)hashFile(inputPath));
+    image.keyValues["KTXwriter"] = "Lesson1 TextureBake";
+    image.keyValues["KTXorientation"] = flip ? "ru" : "rd";
+    image.keyValues["L1SourceHash"] = sourceHash;
+    if (!Ktx2::write(outputPath, image))
+        return 1;
+
+    size_t uncompressedBytes = 0;
+    for (const auto& level : levels)
+        uncompressedBytes += level.pixels.size();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    static const char* FORMAT_NAMES[] = { "BC1", "BC3", "BC4", "BC5" };
+    std::cout << inputPath << " -> " << outputPath << ": " << width << "x" << height << ", " << levels.size() << " levels, "
+              << FORMAT_NAMES[format] << (srgb && (format == BlockCompression::BC1 || format == BlockCompression::BC3) ? " sRGB" : "")
+              << ", " << uncompressedBytes << " -> " << compressedBytes << " bytes ("
+              << (double)uncompressedBytes / compressedBytes << ":1), " << seconds * 1000.0 << " ms" << std::endl;
+    return 0;
+}